@@ -35,6 +35,7 @@
 #include <AMReX_FabSet.H>
 #include <AMReX_StateData.H>
 #include <AMReX_PlotFileUtil.H>
+#include <AMReX_FillPatchUtil.H>
 #include <AMReX_Print.H>
 
 #ifdef AMREX_USE_FBOXLIB_MG
@@ -62,6 +63,7 @@ std::list<std::string> Amr::state_plot_vars;
 std::list<std::string> Amr::state_small_plot_vars;
 std::list<std::string> Amr::derive_plot_vars;
 std::list<std::string> Amr::derive_small_plot_vars;
+Vector<PlotReduction>  Amr::small_plot_reductions;
 bool                   Amr::first_plotfile;
 bool                   Amr::first_smallplotfile;
 Vector<BoxArray>        Amr::initial_ba;
@@ -139,6 +141,7 @@ Amr::Finalize ()
     Amr::state_plot_vars.clear();
     Amr::derive_plot_vars.clear();
     Amr::derive_small_plot_vars.clear();
+    Amr::small_plot_reductions.clear();
     Amr::regrid_ba.clear();
     Amr::initial_ba.clear();
 
@@ -466,6 +469,33 @@ Amr::InitAmr ()
     rebalance_grids = 0;
     pp.query("rebalance_grids", rebalance_grids);
 
+    async_advance = 0;
+    pp.query("async_advance", async_advance);
+#if defined(BL_USE_MPI) && defined(_OPENMP)
+    if (async_advance)
+    {
+        int provided;
+        BL_MPI_REQUIRE( MPI_Query_thread(&provided) );
+        if (provided < MPI_THREAD_FUNNELED)
+        {
+            amrex::Print() << "Warning: amr.async_advance needs MPI_THREAD_FUNNELED; it is turned off\n";
+            async_advance = 0;
+        }
+    }
+#endif
+
+    reuse_crse_patches = 0;
+    pp.query("reuse_crse_patches", reuse_crse_patches);
+
+    regrid_move_fabs = 0;
+    pp.query("regrid_move_fabs", regrid_move_fabs);
+
+    regrid_move_fabs_max_fac = 1.1;
+    pp.query("regrid_move_fabs_max_fac", regrid_move_fabs_max_fac);
+
+    derive_cache = 0;
+    pp.query("derive_cache", derive_cache);
+
     loadbalance_with_workestimates = 0;
     pp.query("loadbalance_with_workestimates", loadbalance_with_workestimates);
 
@@ -474,6 +504,18 @@ Amr::InitAmr ()
 
     loadbalance_max_fac = 1.5;
     pp.query("loadbalance_max_fac", loadbalance_max_fac);
+
+    loadbalance_cell_weight = 1.0;
+    pp.query("loadbalance_cell_weight", loadbalance_cell_weight);
+
+    loadbalance_particle_weight = 0.0;
+    pp.query("loadbalance_particle_weight", loadbalance_particle_weight);
+
+    loadbalance_strategy = "knapsack";
+    pp.query("loadbalance_strategy", loadbalance_strategy);
+    if (loadbalance_strategy != "knapsack" && loadbalance_strategy != "sfc") {
+        amrex::Abort("Amr: amr.loadbalance_strategy must be knapsack or sfc");
+    }
 }
 
 bool
@@ -616,6 +658,67 @@ Amr::fillDeriveSmallPlotVarList ()
     }
 }
 
+void
+Amr::addSmallPlotReduction (const PlotReduction& reduction)
+{
+    small_plot_reductions.push_back(reduction);
+}
+
+void
+Amr::clearSmallPlotReductions ()
+{
+    small_plot_reductions.clear();
+}
+
+void
+Amr::setSmallPlotReductions ()
+{
+    ParmParse pp("amr");
+    ParmParse ppr("amr.small_plot_reduce");
+
+    clearSmallPlotReductions();
+
+    const int nvars = pp.countval("small_plot_reduce_vars");
+
+    for (int i = 0; i < nvars; i++)
+    {
+        std::string name;
+        pp.get("small_plot_reduce_vars", name, i);
+
+        const int nval = ppr.countval(name.c_str());
+        if (nval == 0) {
+            amrex::Error("Amr::setSmallPlotReductions: no amr.small_plot_reduce." + name);
+        }
+
+        for (int k = 0; k < nval; )
+        {
+            PlotReduction reduction;
+            reduction.name  = name;
+            reduction.ratio = 1;
+            reduction.dir   = 0;
+            reduction.coord = 0.0;
+
+            std::string type;
+            ppr.get(name.c_str(), type, k++);
+
+            if (type == "coarsen") {
+                reduction.type = PlotReduction::Coarsen;
+                ppr.get(name.c_str(), reduction.ratio, k++);
+            } else if (type == "slice") {
+                reduction.type = PlotReduction::Slice;
+                ppr.get(name.c_str(), reduction.dir, k++);
+                ppr.get(name.c_str(), reduction.coord, k++);
+            } else if (type == "stats") {
+                reduction.type = PlotReduction::Stats;
+            } else {
+                amrex::Error("Amr::setSmallPlotReductions: unknown reduction " + type);
+            }
+
+            addSmallPlotReduction(reduction);
+        }
+    }
+}
+
 void
 Amr::clearDerivePlotVarList ()
 {
@@ -919,11 +1022,12 @@ Amr::writeSmallPlotFile ()
     if (first_smallplotfile) {
         first_smallplotfile = false;
         amr_level[0]->setSmallPlotVariables();
+        setSmallPlotReductions();
     }
 
     // Don't continue if we have no variables to plot.
     
-    if (stateSmallPlotVars().size() == 0) {
+    if (stateSmallPlotVars().size() == 0 && smallPlotReductions().empty()) {
       return;
     }
 
@@ -973,6 +1077,11 @@ Amr::writeSmallPlotFile ()
     }
 
 
+    //
+    // With only reductions, there is no Header and no plotfile data.
+    //
+    const bool write_vars = stateSmallPlotVars().size() > 0;
+
     std::string HeaderFileName(pltfileTemp + "/Header");
 
     VisMF::IO_Buffer io_buffer(VisMF::GetIOBufferSize());
@@ -983,7 +1092,7 @@ Amr::writeSmallPlotFile ()
 
     int old_prec(0);
 
-    if (ParallelDescriptor::IOProcessor()) {
+    if (write_vars && ParallelDescriptor::IOProcessor()) {
         //
         // Only the IOProcessor() writes to the header file.
         //
@@ -995,11 +1104,42 @@ Amr::writeSmallPlotFile ()
         old_prec = HeaderFile.precision(15);
     }
 
-    for (int k(0); k <= finest_level; ++k) {
-        amr_level[k]->writeSmallPlotFile(pltfileTemp, HeaderFile);
+    if (write_vars) {
+        for (int k(0); k <= finest_level; ++k) {
+            amr_level[k]->writeSmallPlotFile(pltfileTemp, HeaderFile);
+        }
     }
 
-    if (ParallelDescriptor::IOProcessor()) {
+    if ( ! smallPlotReductions().empty()) {
+        //
+        // The reduced data are written next to the plotfile data, with
+        // a list of them in the file Reductions.
+        //
+        if (ParallelDescriptor::IOProcessor()) {
+            std::ofstream os((pltfileTemp + "/Reductions").c_str());
+            os.precision(15);
+            os << cumtime << ' ' << level_steps[0] << ' ' << finest_level << '\n';
+            for (const PlotReduction& r : smallPlotReductions()) {
+                os << r.name << ' ';
+                switch (r.type) {
+                case PlotReduction::Coarsen:
+                    os << "coarsen " << r.ratio << '\n';
+                    break;
+                case PlotReduction::Slice:
+                    os << "slice " << r.dir << ' ' << r.coord << '\n';
+                    break;
+                case PlotReduction::Stats:
+                    os << "stats\n";
+                    break;
+                }
+            }
+        }
+        for (int k(0); k <= finest_level; ++k) {
+            amr_level[k]->writeSmallPlotReductions(pltfileTemp);
+        }
+    }
+
+    if (write_vars && ParallelDescriptor::IOProcessor()) {
         HeaderFile.precision(old_prec);
         if ( ! HeaderFile.good()) {
             amrex::Error("Amr::writeSmallPlotFile() failed");
@@ -1305,8 +1445,10 @@ Amr::FinalizeInit (Real              strt_time,
     for (int lev = 0; lev <= finest_level; lev++)
         amr_level[lev]->setTimeLevel(strt_time,dt_level[lev],dt_level[lev]);
 
-    for (int lev = 0; lev <= finest_level; lev++)
+    for (int lev = 0; lev <= finest_level; lev++) {
+        clearDeriveCaches();
         amr_level[lev]->post_regrid(0,finest_level);
+    }
 
     for (int lev = 0; lev <= finest_level; lev++)
     {
@@ -1318,6 +1460,7 @@ Amr::FinalizeInit (Real              strt_time,
     // Perform any special post_initialization operations.
     //
     for(int lev(0); lev <= finest_level; ++lev) {
+      clearDeriveCaches();
       amr_level[lev]->post_init(stop_time);
     }
 
@@ -1546,6 +1689,7 @@ Amr::restart (const std::string& filename)
        // Build any additional data structures.
        //
        for (int lev = 0; lev <= finest_level; lev++) {
+           clearDeriveCaches();
            amr_level[lev]->post_restart();
        }
 
@@ -1614,6 +1758,7 @@ Amr::restart (const std::string& filename)
        // Build any additional data structures.
        //
        for (int lev = 0; lev <= new_finest_level; lev++) {
+           clearDeriveCaches();
            amr_level[lev]->post_restart();
        }
     }
@@ -1949,6 +2094,12 @@ Amr::timeStep (int  level,
 	amrex::Print() << "[Level " << level << " step " << level_steps[level]+1 << "] "
 		       << "ADVANCE with dt = " << dt_level[level] << "\n";
     }
+    //
+    // The derived quantities of this level and the finer ones are out of
+    // date once this level is advanced.
+    //
+    clearDeriveCaches(level);
+
     BL_PROFILE_REGION_START("amr_level.advance");
     Real dt_new = amr_level[level]->advance(time,dt_level[level],iteration,niter);
     BL_PROFILE_REGION_STOP("amr_level.advance");
@@ -1985,33 +2136,130 @@ Amr::timeStep (int  level,
     }
 
     //
-    // Advance grids at higher level.
+    // Advance grids at higher level.  The steps of the finer levels depend
+    // on the advance of this level and on each other, and post_timestep
+    // depends on all of them, so they are done in order.  post_advance
+    // depends only on the advance of this level; with async_advance it is
+    // an OpenMP task that runs while the finer levels are advanced.
     //
+    AmrLevel* amrlev = amr_level[level].get();
+
     if (level < finest_level)
     {
-        const int lev_fine = level+1;
+        //
+        // The data of this level do not change while the finer levels are
+        // advanced, so FillPatch can keep its copies of them.
+        //
+        Vector<const MultiFab*> crse_data;
+        if (reuse_crse_patches)
+        {
+            for (int i = 0; i < AmrLevel::get_desc_lst().size(); ++i)
+            {
+                const StateData& sd = amrlev->get_state_data(i);
+                if (sd.hasOldData()) crse_data.push_back(&sd.oldData());
+                if (sd.hasNewData()) crse_data.push_back(&sd.newData());
+            }
+            FillPatchBeginReuse(crse_data);
+        }
 
-        if (sub_cycle)
+#ifdef _OPENMP
+        const int nthreads = omp_get_max_threads();
+        if (async_advance && nthreads > 1)
         {
-            const int ncycle = n_cycle[lev_fine];
+            //
+            // The finer levels, which communicate, are advanced by the
+            // master thread, since MPI only has to support funneled calls.
+            // post_advance is a task for the other thread of the team.
+            // Each runs in a nested region of one thread, so that the
+            // serial MFIter loops in them are not split over the team; its
+            // MFIter regions get one thread for post_advance and the rest
+            // for the finer levels, so nthreads threads are used in all.
+            // The finer levels nest their regions in this one, so the
+            // outermost level allows enough active levels for all of them.
+            //
+            const bool outermost = omp_get_active_level() == 0;
+            const int max_active = omp_get_max_active_levels();
+            if (outermost) {
+                omp_set_max_active_levels(std::max(max_active, max_level-level+1));
+            }
+
+#pragma omp parallel num_threads(2)
+            {
+#pragma omp single nowait
+                {
+#pragma omp task
+                    {
+#pragma omp parallel num_threads(1)
+                        {
+                            omp_set_num_threads(1);
+                            amrlev->post_advance(iteration);
+                        }
+                    }
+                }
+
+#pragma omp master
+                {
+#pragma omp parallel num_threads(1)
+                    {
+                        omp_set_num_threads(nthreads-1);
+                        advanceFinerLevels(level,time,stop_time);
+                    }
+                }
+            }
 
-            BL_COMM_PROFILE_NAMETAG("Amr::timeStep timeStep subcycle");
-            for (int i = 1; i <= ncycle; i++)
-                timeStep(lev_fine,time+(i-1)*dt_level[lev_fine],i,ncycle,stop_time);
+            if (outermost) {
+                omp_set_max_active_levels(max_active);
+            }
         }
         else
+#endif
         {
-            BL_COMM_PROFILE_NAMETAG("Amr::timeStep timeStep nosubcycle");
-            timeStep(lev_fine,time,1,1,stop_time);
+            amrlev->post_advance(iteration);
+            advanceFinerLevels(level,time,stop_time);
         }
+
+        FillPatchEndReuse(crse_data);
+    }
+    else
+    {
+        amrlev->post_advance(iteration);
     }
 
+    //
+    // The finer levels may have changed this level, as by refluxing.  The
+    // coarser levels are left alone, since their post_advance may still be
+    // running.
+    //
+    clearDeriveCaches(level);
+
     amr_level[level]->post_timestep(iteration);
 
     // Set this back to negative so we know whether we are in fact in this routine
     which_level_being_advanced = -1;
 }
 
+void
+Amr::advanceFinerLevels (int  level,
+                         Real time,
+                         Real stop_time)
+{
+    const int lev_fine = level+1;
+
+    if (sub_cycle)
+    {
+        const int ncycle = n_cycle[lev_fine];
+
+        BL_COMM_PROFILE_NAMETAG("Amr::timeStep timeStep subcycle");
+        for (int i = 1; i <= ncycle; i++)
+            timeStep(lev_fine,time+(i-1)*dt_level[lev_fine],i,ncycle,stop_time);
+    }
+    else
+    {
+        BL_COMM_PROFILE_NAMETAG("Amr::timeStep timeStep nosubcycle");
+        timeStep(lev_fine,time,1,1,stop_time);
+    }
+}
+
 Real
 Amr::coarseTimeStepDt (Real stop_time)
 {
@@ -2062,6 +2310,7 @@ Amr::coarseTimeStep (Real stop_time)
 
     cumtime += dt_level[0];
 
+    clearDeriveCaches();
     amr_level[0]->postCoarseTimeStep(cumtime);
 
 #ifdef BL_PROFILING
@@ -2427,6 +2676,36 @@ Amr::regrid (int  lbase,
         }
         else if (new_dmap[lev].empty()) {
 	    new_dmap[lev].define(new_grid_places[lev]);
+            if (regrid_move_fabs && amr_level[lev] && !initial) {
+                //
+                // Leave the grids that are unchanged on their processes, so
+                // that their data can be moved to the new level, as long as
+                // no process gets more than regrid_move_fabs_max_fac times
+                // the largest number of cells per process of the new map.
+                //
+                const BoxArray& old_ba = amr_level[lev]->boxArray();
+                const DistributionMapping& old_dm = amr_level[lev]->DistributionMap();
+                Vector<int> pmap = new_dmap[lev].ProcessorMap();
+                Vector<long> ncells(ParallelDescriptor::NProcs(), 0L);
+                for (int i = 0, N = pmap.size(); i < N; ++i) {
+                    ncells[pmap[i]] += new_grid_places[lev][i].numPts();
+                }
+                const long nmax = *std::max_element(ncells.begin(), ncells.end());
+                for (int i = 0, N = pmap.size(); i < N; ++i) {
+                    const Box& bx = new_grid_places[lev][i];
+                    for (const auto& is : old_ba.intersections(bx)) {
+                        const int p = old_dm[is.first];
+                        if (old_ba[is.first] == bx && p != pmap[i] &&
+                            ncells[p] + bx.numPts() <= regrid_move_fabs_max_fac*nmax)
+                        {
+                            ncells[pmap[i]] -= bx.numPts();
+                            ncells[p]       += bx.numPts();
+                            pmap[i] = p;
+                        }
+                    }
+                }
+                new_dmap[lev] = DistributionMapping(pmap);
+            }
 	}
 
         AmrLevel* a = (*levelbld)(*this,lev,Geom(lev),new_grid_places[lev],
@@ -2451,7 +2730,11 @@ Amr::regrid (int  lbase,
             // NOTE: The init function may use a filPatch from the old level,
             //       which therefore needs remain in the hierarchy during the call.
             //
+            if (regrid_move_fabs) {
+                AmrLevel::BeginMoveFabs(*amr_level[lev], *a);
+            }
             a->init(*amr_level[lev]);
+            AmrLevel::EndMoveFabs();
             amr_level[lev].reset(a);
 	    this->SetBoxArray(lev, amr_level[lev]->boxArray());
 	    this->SetDistributionMap(lev, amr_level[lev]->DistributionMap());
@@ -2472,6 +2755,7 @@ Amr::regrid (int  lbase,
     //       at levels lbase+1 and higher may have changed.  
     //
     for(int lev(0); lev <= new_finest; ++lev) {
+      clearDeriveCaches();
       amr_level[lev]->post_regrid(lbase,new_finest);
     }
 
@@ -2554,27 +2838,52 @@ Amr::makeLoadBalanceDistributionMap (int lev, Real time, const BoxArray& ba) con
     DistributionMapping newdm;
 
     const int work_est_type = amr_level[0]->WorkEstType();
+    const bool with_particles = loadbalance_particle_weight > 0.0;
 
-    if (work_est_type < 0) {
+    if (work_est_type < 0 && !with_particles) {
         amrex::Print() << "\nAMREX WARNING: work estimates type does not exist!\n\n";
         newdm.define(ba);
     }
     else if (amr_level[lev])
     {
-        DistributionMapping dmtmp;
-        if (ba.size() == boxArray(lev).size()) {
-            dmtmp = DistributionMap(lev);
-        } else {
-            dmtmp.define(ba);
+        //
+        // The cost of a box is that of its cells, given by the work estimates
+        // if there are any, plus that of its particles.
+        //
+        std::unique_ptr<MultiFab> workest;
+        if (work_est_type >= 0)
+        {
+            DistributionMapping dmtmp;
+            if (ba.size() == boxArray(lev).size()) {
+                dmtmp = DistributionMap(lev);
+            } else {
+                dmtmp.define(ba);
+            }
+
+            workest.reset(new MultiFab(ba, dmtmp, 1, 0, MFInfo(), FArrayBoxFactory()));
+            AmrLevel::FillPatch(*amr_level[lev], *workest, 0, time, work_est_type, 0, 1, 0);
         }
 
-        MultiFab workest(ba, dmtmp, 1, 0, MFInfo(), FArrayBoxFactory());
-        AmrLevel::FillPatch(*amr_level[lev], workest, 0, time, work_est_type, 0, 1, 0);
+        Vector<long> nparticles;
+        if (with_particles) {
+            nparticles = amr_level[lev]->particleCounts(ba);
+        }
 
-        Real navg = static_cast<Real>(ba.size()) / static_cast<Real>(ParallelDescriptor::NProcs());
-        int nmax = std::max(std::round(loadbalance_max_fac*navg), std::ceil(navg));
+        const Vector<Real>& rcost
+            = DistributionMapping::makeCombinedCost(ba, nparticles, loadbalance_cell_weight,
+                                                    loadbalance_particle_weight, workest.get());
 
-        newdm = DistributionMapping::makeKnapSack(workest, nmax);
+        if (loadbalance_strategy == "sfc")
+        {
+            newdm = DistributionMapping::makeSFC(rcost, ba);
+        }
+        else
+        {
+            Real navg = static_cast<Real>(ba.size()) / static_cast<Real>(ParallelDescriptor::NProcs());
+            int nmax = std::max(std::round(loadbalance_max_fac*navg), std::ceil(navg));
+
+            newdm = DistributionMapping::makeKnapSack(rcost, nmax);
+        }
     }
     else
     {
@@ -2590,6 +2899,7 @@ Amr::LoadBalanceLevel0 (Real time)
     BL_PROFILE("LoadBalanceLevel0()");
     const auto& dm = makeLoadBalanceDistributionMap(0, time, boxArray(0));
     InstallNewDistributionMap(0, dm);
+    clearDeriveCaches();
     amr_level[0]->post_regrid(0,time);
 }
 
@@ -2642,6 +2952,7 @@ Amr::regrid_level_0_on_restart()
 	this->SetBoxArray(0, amr_level[0]->boxArray());
 	this->SetDistributionMap(0, amr_level[0]->DistributionMap());
 
+	clearDeriveCaches();
 	amr_level[0]->post_regrid(0,0);
 	
 	if (ParallelDescriptor::IOProcessor())
@@ -2823,6 +3134,14 @@ Amr::ManualTagsPlacement (int lev, TagBoxArray& tags, const Vector<IntVect>& bf_
     amr_level[lev]->manual_tags_placement(tags, bf_lev);
 }
 
+void
+Amr::clearDeriveCaches (int lbase)
+{
+    for (int lev = lbase; lev <= finest_level; ++lev) {
+        if (amr_level[lev]) amr_level[lev]->clearDeriveCache();
+    }
+}
+
 void
 Amr::bldFineLevels (Real strt_time)
 {
@@ -3272,6 +3591,10 @@ Amr::AddProcsToComp(int nSidecarProcs, int prevSidecarProcs) {
         allInts.push_back(record_run_info);
         allInts.push_back(record_run_info_terse);
         allInts.push_back(sub_cycle);
+        allInts.push_back(async_advance);
+        allInts.push_back(reuse_crse_patches);
+        allInts.push_back(regrid_move_fabs);
+        allInts.push_back(derive_cache);
         allInts.push_back(stream_max_tries);
         allInts.push_back(rebalance_grids);
         allInts.push_back(loadbalance_with_workestimates);
@@ -3348,6 +3671,10 @@ Amr::AddProcsToComp(int nSidecarProcs, int prevSidecarProcs) {
         record_run_info            = allInts[count++];
         record_run_info_terse      = allInts[count++];
         sub_cycle                  = allInts[count++];
+        async_advance              = allInts[count++];
+        reuse_crse_patches         = allInts[count++];
+        regrid_move_fabs           = allInts[count++];
+        derive_cache               = allInts[count++];
         stream_max_tries           = allInts[count++];
         rebalance_grids            = allInts[count++];
         loadbalance_with_workestimates  = allInts[count++];
@@ -3430,6 +3757,9 @@ Amr::AddProcsToComp(int nSidecarProcs, int prevSidecarProcs) {
         allReals.push_back(check_per);
         allReals.push_back(plot_per);
         allReals.push_back(small_plot_per);
+        allReals.push_back(loadbalance_cell_weight);
+        allReals.push_back(loadbalance_particle_weight);
+        allReals.push_back(regrid_move_fabs_max_fac);
 
         for(int i(0); i < dt_level.size(); ++i)   { allReals.push_back(dt_level[i]); }
         for(int i(0); i < dt_min.size(); ++i)     { allReals.push_back(dt_min[i]); }
@@ -3448,6 +3778,9 @@ Amr::AddProcsToComp(int nSidecarProcs, int prevSidecarProcs) {
         check_per  = allReals[count++];
         plot_per   = allReals[count++];
         small_plot_per = allReals[count++];
+        loadbalance_cell_weight     = allReals[count++];
+        loadbalance_particle_weight = allReals[count++];
+        regrid_move_fabs_max_fac    = allReals[count++];
 
 	dt_level.resize(dt_level_Size);
         for(int i(0); i < dt_level.size(); ++i)  { dt_level[i] = allReals[count++]; }
@@ -3467,6 +3800,7 @@ Amr::AddProcsToComp(int nSidecarProcs, int prevSidecarProcs) {
 
         allBools.push_back(plot_files_output);
         allBools.push_back(refine_grid_layout);
+        allBools.push_back(distributed_clustering);
         allBools.push_back(checkpoint_files_output);
         allBools.push_back(initialized);
         allBools.push_back(use_fixed_coarse_grids);
@@ -3500,6 +3834,7 @@ Amr::AddProcsToComp(int nSidecarProcs, int prevSidecarProcs) {
 
         plot_files_output             = allBools[count++];
         refine_grid_layout            = allBools[count++];
+        distributed_clustering        = allBools[count++];
         checkpoint_files_output       = allBools[count++];
         initialized                   = allBools[count++];
         use_fixed_coarse_grids        = allBools[count++];
@@ -3532,6 +3867,7 @@ Amr::AddProcsToComp(int nSidecarProcs, int prevSidecarProcs) {
         allStrings.push_back(restart_chkfile);
         allStrings.push_back(restart_pltfile);
         allStrings.push_back(probin_file);
+        allStrings.push_back(loadbalance_strategy);
 
         std::list<std::string>::iterator lit;
 	for( lit = state_plot_vars.begin(); lit != state_plot_vars.end(); ++lit) {
@@ -3567,6 +3903,7 @@ Amr::AddProcsToComp(int nSidecarProcs, int prevSidecarProcs) {
         restart_chkfile    = allStrings[count++];
         restart_pltfile    = allStrings[count++];
         probin_file        = allStrings[count++];
+        loadbalance_strategy = allStrings[count++];
 
         for(int i(0); i < state_plot_vars_Size; ++i) {
           state_plot_vars.push_back(allStrings[count++]);
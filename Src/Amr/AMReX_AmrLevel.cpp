@@ -1,4 +1,6 @@
 
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 
 #include <unistd.h>
@@ -32,6 +34,10 @@ EBSupport AmrLevel::m_eb_support_level = EBSupport::volume;
 DescriptorList AmrLevel::desc_lst;
 DeriveList     AmrLevel::derive_lst;
 
+AmrLevel*      AmrLevel::move_fabs_from = 0;
+AmrLevel*      AmrLevel::move_fabs_to   = 0;
+Vector<int>    AmrLevel::move_fabs_done;
+
 void
 AmrLevel::postCoarseTimeStep (Real time)
 {
@@ -71,6 +77,7 @@ AmrLevel::AmrLevel ()
    parent = 0;
    level = -1;
    levelDirectoryCreated = false;
+   derive_cache_time = 0;
 }
 
 AmrLevel::AmrLevel (Amr&            papa,
@@ -88,6 +95,7 @@ AmrLevel::AmrLevel (Amr&            papa,
     level  = lev;
     parent = &papa;
     levelDirectoryCreated = false;
+    derive_cache_time = 0;
 
     fine_ratio = IntVect::TheUnitVector(); fine_ratio.scale(-1);
     crse_ratio = IntVect::TheUnitVector(); crse_ratio.scale(-1);
@@ -154,7 +162,22 @@ AmrLevel::writePlotFile (const std::string& dir,
 	}
     }
 
-    int n_data_items = plot_var_map.size();
+    //
+    // The cell-centered derived quantities to write to plotfile.
+    //
+    Vector<std::string> derive_names;
+    int n_derive = 0;
+    for (const DeriveRec& rec : derive_lst.dlist())
+    {
+        if (parent->isDerivePlotVar(rec.name()) &&
+            rec.deriveType() == IndexType::TheCellType())
+        {
+            derive_names.push_back(rec.name());
+            n_derive += rec.numDerive();
+        }
+    }
+
+    int n_data_items = plot_var_map.size() + n_derive;
 
     // get the time from the first State_Type
     // if the State_Type is ::Interval, this will get t^{n+1/2} instead of t^n
@@ -181,6 +204,12 @@ AmrLevel::writePlotFile (const std::string& dir,
 	    int comp = plot_var_map[i].second;
 	    os << desc_lst[typ].name(comp) << '\n';
         }
+        for (const std::string& name : derive_names)
+        {
+            const DeriveRec* rec = derive_lst.get(name);
+            for (int k = 0; k < rec->numDerive(); k++)
+                os << rec->variableName(k) << '\n';
+        }
 
         os << AMREX_SPACEDIM << '\n';
         os << parent->cumTime() << '\n';
@@ -267,7 +296,6 @@ AmrLevel::writePlotFile (const std::string& dir,
     //
     // We combine all of the multifabs -- state, derived, etc -- into one
     // multifab -- plotMF.
-    // NOTE: In this tutorial code, there is no derived data
     int       cnt   = 0;
     const int nGrow = 0;
     MultiFab  plotMF(grids,dmap,n_data_items,nGrow,MFInfo(),Factory());
@@ -283,6 +311,14 @@ AmrLevel::writePlotFile (const std::string& dir,
 	MultiFab::Copy(plotMF,*this_dat,comp,cnt,1,nGrow);
 	cnt++;
     }
+    //
+    // Derived quantities, those from the same state data together.
+    //
+    if (n_derive > 0)
+    {
+        derive(derive_names,cur_time,plotMF,cnt);
+        cnt += n_derive;
+    }
 
     //
     // Use the Full pathname when naming the MultiFab.
@@ -295,6 +331,118 @@ AmrLevel::writePlotFile (const std::string& dir,
 }
 
 
+void
+AmrLevel::writeSmallPlotReductions (const std::string& dir)
+{
+    char buf[64];
+    sprintf(buf, "Level_%d", level);
+    std::string FullPath = dir;
+    if ( ! FullPath.empty() && FullPath[FullPath.size()-1] != '/')
+    {
+        FullPath += '/';
+    }
+    FullPath += buf;
+
+    if ( ! levelDirectoryCreated) {
+      if (ParallelDescriptor::IOProcessor()) {
+        if ( ! amrex::UtilCreateDirectory(FullPath, 0755)) {
+            amrex::CreateDirectoryFailed(FullPath);
+        }
+      }
+      ParallelDescriptor::Barrier();
+    }
+    FullPath += '/';
+
+    Real cur_time = state[0].curTime();
+
+    for (const PlotReduction& r : parent->smallPlotReductions())
+    {
+        std::unique_ptr<MultiFab> mf = derive(r.name, cur_time, 0);
+        const int ncomp = mf->nComp();
+
+        if ( ! mf->boxArray().ixType().cellCentered()) {
+            amrex::Error("AmrLevel::writeSmallPlotReductions: " + r.name + " is not cell-centered");
+        }
+
+        switch (r.type)
+        {
+        case PlotReduction::Coarsen:
+        {
+            if ( ! grids.coarsenable(r.ratio)) {
+                amrex::Error("AmrLevel::writeSmallPlotReductions: the grids are not coarsenable by "
+                             + std::to_string(r.ratio));
+            }
+            MultiFab crse(amrex::coarsen(grids, r.ratio), dmap, ncomp, 0, MFInfo(), Factory());
+            amrex::average_down(*mf, crse, 0, ncomp, r.ratio);
+            VisMF::Write(crse, FullPath + r.name + "_coarsen" + std::to_string(r.ratio));
+            break;
+        }
+        case PlotReduction::Slice:
+        {
+            //
+            // get_slice_data needs a grid cut by the slice.
+            //
+            Box plane = geom.Domain();
+            const int i = geom.Domain().smallEnd(r.dir)
+                + std::floor((r.coord - geom.ProbLo(r.dir))/geom.CellSize(r.dir));
+            if (i < geom.Domain().smallEnd(r.dir) || i > geom.Domain().bigEnd(r.dir)) {
+                if (ParallelDescriptor::IOProcessor()) {
+                    amrex::Warning("AmrLevel::writeSmallPlotReductions: slice of " + r.name
+                                   + " is outside the domain, skipped");
+                }
+                break;
+            }
+            plane.setSmall(r.dir, i);
+            plane.setBig(r.dir, i);
+            if (grids.intersects(plane)) {
+                std::unique_ptr<MultiFab> slice = amrex::get_slice_data(r.dir, r.coord, *mf, geom, 0, ncomp);
+                VisMF::Write(*slice, FullPath + r.name + "_slice" + std::to_string(r.dir));
+            }
+            break;
+        }
+        case PlotReduction::Stats:
+        {
+            Vector<Real> stats(3*ncomp*grids.size(), 0.0);
+            for (MFIter mfi(*mf); mfi.isValid(); ++mfi)
+            {
+                const Box& bx = mfi.validbox();
+                const FArrayBox& fab = (*mf)[mfi];
+                for (int n = 0; n < ncomp; ++n)
+                {
+                    Real* s = &stats[3*(ncomp*mfi.index()+n)];
+                    s[0] = fab.min(bx,n);
+                    s[1] = fab.max(bx,n);
+                    s[2] = fab.sum(bx,n)/bx.numPts();
+                }
+            }
+            const int IOProc = ParallelDescriptor::IOProcessorNumber();
+            ParallelDescriptor::ReduceRealSum(stats.dataPtr(), stats.size(), IOProc);
+
+            if (ParallelDescriptor::IOProcessor())
+            {
+                //
+                // The grid, then the minimum, maximum and mean of each component.
+                //
+                std::ofstream os((FullPath + r.name + "_stats").c_str());
+                os.precision(15);
+                os << cur_time << ' ' << grids.size() << ' ' << ncomp << '\n';
+                for (int i = 0; i < grids.size(); ++i)
+                {
+                    os << grids[i];
+                    for (int k = 0; k < 3*ncomp; ++k) {
+                        os << ' ' << stats[3*ncomp*i+k];
+                    }
+                    os << '\n';
+                }
+            }
+            break;
+        }
+        }
+    }
+
+    levelDirectoryCreated = false;
+}
+
 void
 AmrLevel::writePlotFilePre (const std::string& dir,
                             std::ostream&      os)
@@ -1578,6 +1726,12 @@ AmrLevel::derive (const std::string& name,
 	    ngrow_src += g;
 	}
 
+        mf.reset(new MultiFab(dstBA, dmap, rec->numDerive(), ngrow, MFInfo(), *m_factory));
+
+        if (deriveFromCache(name, time, *mf, 0, rec->numDerive())) {
+            return mf;
+        }
+
         MultiFab srcMF(srcBA, dmap, rec->numState(), ngrow_src, MFInfo(), *m_factory);
 
         for (int k = 0, dc = 0; k < rec->numRange(); k++, dc += ncomp)
@@ -1586,8 +1740,6 @@ AmrLevel::derive (const std::string& name,
             FillPatch(*this,srcMF,ngrow_src,time,index,scomp,ncomp,dc);
         }
 
-        mf.reset(new MultiFab(dstBA, dmap, rec->numDerive(), ngrow, MFInfo(), *m_factory));
-
 #ifdef CRSEGRNDOMP
 #ifdef _OPENMP
 #pragma omp parallel
@@ -1636,7 +1788,7 @@ AmrLevel::derive (const std::string& name,
         for (MFIter mfi(srcMF); mfi.isValid(); ++mfi)
         {
             int         grid_no = mfi.index();
-            const RealBox gridloc(grids[grid_no],geom.CellSize(),geom.ProbLo());
+            const RealBox gridloc((*mf)[mfi].box(),geom.CellSize(),geom.ProbLo());
             Real*       ddat    = (*mf)[mfi].dataPtr();
             const int*  dlo     = (*mf)[mfi].loVect();
             const int*  dhi     = (*mf)[mfi].hiVect();
@@ -1671,6 +1823,7 @@ AmrLevel::derive (const std::string& name,
 	    }
         }
 #endif
+        deriveToCache(name, time, *mf, 0, rec->numDerive());
     }
     else
     {
@@ -1703,6 +1856,10 @@ AmrLevel::derive (const std::string& name,
     }
     else if (const DeriveRec* rec = derive_lst.get(name))
     {
+        if (deriveFromCache(name, time, mf, dcomp, rec->numDerive())) {
+            return;
+        }
+
         rec->getRange(0,index,scomp,ncomp);
 
         const BoxArray& srcBA = state[index].boxArray();
@@ -1807,6 +1964,7 @@ AmrLevel::derive (const std::string& name,
 	    }
         }
 #endif
+        deriveToCache(name, time, mf, dcomp, rec->numDerive());
     }
     else
     {
@@ -1819,6 +1977,243 @@ AmrLevel::derive (const std::string& name,
     }
 }
 
+namespace {
+
+//
+// Calls the function of rec on bx of dfab, from the state data in sfab.
+//
+void
+derive_fab (const DeriveRec& rec,
+            FArrayBox&       dfab,
+            int              dcomp,
+            const FArrayBox& sfab,
+            const Box&       bx,
+            const Box&       domain,
+            const Geometry&  geom,
+            Real             time,
+            Real             dt,
+            int              level,
+            int              grid_no)
+{
+    Real*         ddat    = dfab.dataPtr(dcomp);
+    const int*    dlo     = dfab.loVect();
+    const int*    dhi     = dfab.hiVect();
+    const int*    lo      = bx.loVect();
+    const int*    hi      = bx.hiVect();
+    int           n_der   = rec.numDerive();
+    const Real*   cdat    = sfab.dataPtr();
+    const int*    clo     = sfab.loVect();
+    const int*    chi     = sfab.hiVect();
+    int           n_state = rec.numState();
+    const int*    dom_lo  = domain.loVect();
+    const int*    dom_hi  = domain.hiVect();
+    const Real*   dx      = geom.CellSize();
+    const int*    bcr     = rec.getBC();
+    const RealBox temp    (bx,geom.CellSize(),geom.ProbLo());
+    const Real*   xlo     = temp.lo();
+
+    if (rec.derFunc() != static_cast<DeriveFunc>(0)){
+        rec.derFunc()(ddat,ARLIM(dlo),ARLIM(dhi),&n_der,
+                      cdat,ARLIM(clo),ARLIM(chi),&n_state,
+                      lo,hi,dom_lo,dom_hi,dx,xlo,&time,&dt,bcr,
+                      &level,&grid_no);
+    } else if (rec.derFunc3D() != static_cast<DeriveFunc3D>(0)){
+        rec.derFunc3D()(ddat,ARLIM_3D(dlo),ARLIM_3D(dhi),&n_der,
+                        cdat,ARLIM_3D(clo),ARLIM_3D(chi),&n_state,
+                        ARLIM_3D(lo),ARLIM_3D(hi),
+                        ARLIM_3D(dom_lo),ARLIM_3D(dom_hi),
+                        ZFILL(dx),ZFILL(xlo),
+                        &time,&dt,
+                        BCREC_3D(bcr),
+                        &level,&grid_no);
+    } else {
+        amrex::Error("AmrLevel::derive: no function available");
+    }
+}
+
+//
+// The derived quantities of AmrLevel::derive(names,...) computed from the
+// same state data.
+//
+struct DeriveGroup
+{
+    Vector<int>              ranges;    // The state type, first component and number of each range.
+    int                      ngrow_src;
+    Vector<const DeriveRec*> recs;
+    Vector<int>              dcomps;
+};
+
+}
+
+void
+AmrLevel::derive (const Vector<std::string>& names,
+                  Real                       time,
+                  MultiFab&                  mf,
+                  int                        dcomp)
+{
+    const int ngrow = mf.nGrow();
+
+    Vector<DeriveGroup> groups;
+
+    int index, scomp, ncomp;
+
+    for (int i = 0, dc = dcomp; i < names.size(); )
+    {
+        if (isStateVariable(names[i], index, scomp))
+        {
+            //
+            // The names that follow and are the next components of the same
+            // state type are filled with it.
+            //
+            int n = 1, index_n, scomp_n;
+            while (i+n < names.size() &&
+                   isStateVariable(names[i+n], index_n, scomp_n) &&
+                   index_n == index && scomp_n == scomp+n)
+            {
+                ++n;
+            }
+            FillPatch(*this,mf,ngrow,time,index,scomp,n,dc);
+            i  += n;
+            dc += n;
+        }
+        else if (const DeriveRec* rec = derive_lst.get(names[i]))
+        {
+            if (!deriveFromCache(names[i], time, mf, dc, rec->numDerive()))
+            {
+                Vector<int> ranges;
+                for (int k = 0; k < rec->numRange(); ++k)
+                {
+                    rec->getRange(k, index, scomp, ncomp);
+                    ranges.push_back(index);
+                    ranges.push_back(scomp);
+                    ranges.push_back(ncomp);
+                }
+                const Box& bx0 = state[ranges[0]].boxArray()[0];
+                const int ngrow_src = ngrow + bx0.smallEnd(0) - rec->boxMap()(bx0).smallEnd(0);
+
+                int g = 0;
+                while (g < groups.size() &&
+                       (groups[g].ranges != ranges || groups[g].ngrow_src != ngrow_src))
+                {
+                    ++g;
+                }
+                if (g == groups.size())
+                {
+                    groups.push_back(DeriveGroup());
+                    groups[g].ranges    = ranges;
+                    groups[g].ngrow_src = ngrow_src;
+                }
+                groups[g].recs.push_back(rec);
+                groups[g].dcomps.push_back(dc);
+            }
+            i  += 1;
+            dc += rec->numDerive();
+        }
+        else
+        {
+            //
+            // A quantity that only a derived class knows.
+            //
+            derive(names[i], time, mf, dc);
+            i  += 1;
+            dc += 1;
+        }
+    }
+
+    const Real dt = parent->dtLevel(level);
+
+    for (const DeriveGroup& grp : groups)
+    {
+        const int index0 = grp.ranges[0];
+        int nstate = 0;
+        for (int k = 2; k < grp.ranges.size(); k += 3) {
+            nstate += grp.ranges[k];
+        }
+
+        MultiFab srcMF(state[index0].boxArray(), dmap, nstate, grp.ngrow_src, MFInfo(), *m_factory);
+
+        for (int k = 0, dc = 0; k < grp.ranges.size(); k += 3)
+        {
+            FillPatch(*this,srcMF,grp.ngrow_src,time,grp.ranges[k],grp.ranges[k+1],grp.ranges[k+2],dc);
+            dc += grp.ranges[k+2];
+        }
+
+        const Box& domain = state[index0].getDomain();
+
+#ifdef CRSEGRNDOMP
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(mf,true); mfi.isValid(); ++mfi)
+        {
+            const Box& gtbx = mfi.growntilebox();
+            for (int r = 0; r < grp.recs.size(); ++r) {
+                derive_fab(*grp.recs[r], mf[mfi], grp.dcomps[r], srcMF[mfi], gtbx,
+                           domain, geom, time, dt, level, mfi.index());
+            }
+        }
+#else
+        for (MFIter mfi(srcMF); mfi.isValid(); ++mfi)
+        {
+            for (int r = 0; r < grp.recs.size(); ++r) {
+                derive_fab(*grp.recs[r], mf[mfi], grp.dcomps[r], srcMF[mfi], mf[mfi].box(),
+                           domain, geom, time, dt, level, mfi.index());
+            }
+        }
+#endif
+
+        for (int r = 0; r < grp.recs.size(); ++r) {
+            deriveToCache(grp.recs[r]->name(), time, mf, grp.dcomps[r], grp.recs[r]->numDerive());
+        }
+    }
+}
+
+bool
+AmrLevel::deriveFromCache (const std::string& name,
+                           Real               time,
+                           MultiFab&          mf,
+                           int                dcomp,
+                           int                ncomp) const
+{
+    if (derive_cache.empty() || time != derive_cache_time) return false;
+
+    auto it = derive_cache.find(name);
+    if (it == derive_cache.end()) return false;
+
+    const MultiFab& cached = *it->second;
+    if (cached.nGrow() != mf.nGrow() ||
+        cached.boxArray() != mf.boxArray() ||
+        cached.DistributionMap() != mf.DistributionMap())
+    {
+        return false;
+    }
+
+    MultiFab::Copy(mf, cached, 0, dcomp, ncomp, mf.nGrow());
+    return true;
+}
+
+void
+AmrLevel::deriveToCache (const std::string& name,
+                         Real               time,
+                         const MultiFab&    mf,
+                         int                dcomp,
+                         int                ncomp)
+{
+    if (!parent->deriveCache()) return;
+    //
+    // Only one time is kept.
+    //
+    if (time != derive_cache_time) {
+        derive_cache.clear();
+        derive_cache_time = time;
+    }
+
+    MultiFab* cached = new MultiFab(mf.boxArray(), mf.DistributionMap(), ncomp, mf.nGrow(),
+                                    MFInfo(), mf.Factory());
+    MultiFab::Copy(*cached, mf, dcomp, 0, ncomp, mf.nGrow());
+    derive_cache[name].reset(cached);
+}
+
 //! Update the distribution maps in StateData based on the size of the map
 void
 AmrLevel::UpdateDistributionMaps ( DistributionMapping& update_dmap )
@@ -2093,11 +2488,130 @@ AmrLevel::FillPatch(AmrLevel& amrlevel,
 {
     BL_ASSERT(dcomp+ncomp-1 <= leveldata.nComp());
     BL_ASSERT(boxGrow <= leveldata.nGrow());
+
+    if (&amrlevel == move_fabs_from && &leveldata == &move_fabs_to->get_new_data(index) &&
+        boxGrow == 0 && scomp == 0 && dcomp == 0 && ncomp == leveldata.nComp() &&
+        MoveFabs(amrlevel, leveldata, time, index))
+    {
+        return;
+    }
+
     FillPatchIterator fpi(amrlevel, leveldata, boxGrow, time, index, scomp, ncomp);
     const MultiFab& mf_fillpatched = fpi.get_mf();
     MultiFab::Copy(leveldata, mf_fillpatched, 0, dcomp, ncomp, boxGrow);
 }
 
+void
+AmrLevel::BeginMoveFabs (AmrLevel& old, AmrLevel& lev)
+{
+    BL_ASSERT(old.level == lev.level);
+    move_fabs_from = &old;
+    move_fabs_to   = &lev;
+    move_fabs_done.clear();
+}
+
+void
+AmrLevel::EndMoveFabs ()
+{
+    move_fabs_from = 0;
+    move_fabs_to   = 0;
+    move_fabs_done.clear();
+}
+
+bool
+AmrLevel::MoveFabs (AmrLevel& old, MultiFab& leveldata, Real time, int index)
+{
+    BL_PROFILE("AmrLevel::MoveFabs()");
+
+#ifdef AMREX_USE_EB
+    amrex::ignore_unused(old);
+    amrex::ignore_unused(leveldata);
+    amrex::ignore_unused(time);
+    amrex::ignore_unused(index);
+    return false;
+#else
+    //
+    // The fabs are moved only if FillPatch would copy the new data of old,
+    // and only once per state type.
+    //
+    if (ParallelDescriptor::TeamSize() > 1 ||
+        std::find(move_fabs_done.begin(), move_fabs_done.end(), index) != move_fabs_done.end())
+    {
+        return false;
+    }
+
+    MultiFab& oldmf = old.state[index].newData();
+    Vector<MultiFab*> smf;
+    Vector<Real> stime;
+    old.state[index].getData(smf, stime, time);
+
+    if (smf.size() != 1 || smf[0] != &oldmf ||
+        oldmf.nComp() != leveldata.nComp() || oldmf.nGrow() != leveldata.nGrow())
+    {
+        return false;
+    }
+
+    move_fabs_done.push_back(index);
+
+    const BoxArray& ba = leveldata.boxArray();
+    const DistributionMapping& dm = leveldata.DistributionMap();
+    const BoxArray& old_ba = oldmf.boxArray();
+    const DistributionMapping& old_dm = oldmf.DistributionMap();
+    //
+    // The index in old of each grid that is on the same process in both
+    // levels, or -1, and the other grids, which are filled as usual.
+    //
+    Vector<int> from(ba.size(), -1);
+    BoxList bl(ba.ixType());
+    Vector<int> pmap;
+    Vector<int> rest;
+    for (int i = 0; i < ba.size(); ++i)
+    {
+        const Box& bx = ba[i];
+        for (const auto& is : old_ba.intersections(bx)) {
+            if (old_ba[is.first] == bx && old_dm[is.first] == dm[i]) {
+                from[i] = is.first;
+            }
+        }
+        if (from[i] < 0) {
+            bl.push_back(bx);
+            pmap.push_back(dm[i]);
+            rest.push_back(i);
+        }
+    }
+
+    if (!rest.empty())
+    {
+        //
+        // The fabs of mf are aliases of those of leveldata.
+        //
+        MultiFab mf(BoxArray(bl), DistributionMapping(pmap), leveldata.nComp(), 0,
+                    MFInfo().SetAlloc(false));
+        for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            mf.setFab(mfi, new FArrayBox(leveldata[rest[mfi.index()]], amrex::make_alias,
+                                         0, leveldata.nComp()));
+        }
+        FillPatchIterator fpi(old, mf, 0, time, index, 0, mf.nComp());
+        MultiFab::Copy(mf, fpi.get_mf(), 0, 0, mf.nComp(), 0);
+    }
+
+    for (MFIter mfi(leveldata); mfi.isValid(); ++mfi)
+    {
+        const int i = mfi.index();
+        const int j = from[i];
+        if (j >= 0)
+        {
+            FArrayBox* fab = oldmf.releaseFab(j);
+            delete leveldata.releaseFab(i);
+            leveldata.setFab(i, fab);
+            oldmf.setFab(j, new FArrayBox(*fab, amrex::make_alias, 0, fab->nComp()));
+        }
+    }
+
+    return true;
+#endif
+}
+
 void
 AmrLevel::FillPatchAdd(AmrLevel& amrlevel,
 		       MultiFab& leveldata,
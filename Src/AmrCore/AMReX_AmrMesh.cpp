@@ -1,4 +1,6 @@
 
+#include <algorithm>
+
 #include <AMReX.H>
 #include <AMReX_AmrMesh.H>
 #include <AMReX_Cluster.H>
@@ -60,6 +62,8 @@ AmrMesh::InitAmrMesh (int max_level_in, const Vector<int>& n_cell_in, std::vecto
     use_fixed_coarse_grids = false;
     use_fixed_upto_level   = 0;
     refine_grid_layout     = true;
+    distributed_clustering = false;
+    incremental_regrid     = false;
     check_input            = true;
     
     ParmParse pp("amr");
@@ -314,6 +318,10 @@ AmrMesh::InitAmrMesh (int max_level_in, const Vector<int>& n_cell_in, std::vecto
 	pp.query("refine_grid_layout", refine_grid_layout);
     }
 
+    pp.query("distributed_clustering", distributed_clustering);
+
+    pp.query("incremental_regrid", incremental_regrid);
+
     pp.query("check_input", check_input);
 
     finest_level = -1;
@@ -395,6 +403,55 @@ AmrMesh::MakeBaseGrids () const
 }
 
 
+BoxList
+AmrMesh::KeptGrids (const BoxArray& old_ba, const IntVect& crse_ratio, const BoxArray& pn,
+                    Vector<IntVect>& tagvec) const
+{
+    BL_PROFILE("AmrMesh::KeptGrids()");
+    //
+    // The grids that are made of whole tag cells and properly nested.
+    //
+    BoxList cand;
+    Vector<int> cand_idx;
+    for (int i = 0; i < old_ba.size(); ++i)
+    {
+        const Box& cbx = amrex::coarsen(old_ba[i], crse_ratio);
+        if (amrex::refine(cbx, crse_ratio) == old_ba[i] && pn.contains(cbx)) {
+            cand.push_back(cbx);
+            cand_idx.push_back(i);
+        }
+    }
+
+    BoxList kept;
+    if (cand.isEmpty()) return kept;
+
+    const BoxArray cand_ba(cand);
+    Vector<long> count(cand_ba.size(), 0);
+    for (const IntVect& iv : tagvec) {
+        for (const auto& is : cand_ba.intersections(Box(iv,iv))) {
+            ++count[is.first];
+        }
+    }
+
+    BoxList kept_crse;
+    for (int k = 0; k < cand_ba.size(); ++k) {
+        if (count[k] > 0 && count[k] >= grid_eff*cand_ba[k].numPts()) {
+            kept_crse.push_back(cand_ba[k]);
+            kept.push_back(old_ba[cand_idx[k]]);
+        }
+    }
+
+    if (kept.isNotEmpty())
+    {
+        const BoxArray kept_ba(kept_crse);
+        tagvec.erase(std::remove_if(tagvec.begin(), tagvec.end(),
+                                    [&kept_ba] (const IntVect& iv) { return kept_ba.contains(iv); }),
+                     tagvec.end());
+    }
+
+    return kept;
+}
+
 void
 AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>& new_grids)
 {
@@ -618,13 +675,68 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
         //
         tags.setVal(p_n_comp[levc],TagBox::CLEAR);
         //
-        // Create initial cluster containing all tagged points.
+        // Efficient properly nested Clusters are constructed, either from
+        // all tagged points gathered on every CPU, or on each CPU from its
+        // own tagged points and merged.
+        //
+        // In the incremental mode, the grids of levf that are still
+        // efficient are kept, and only the tags outside them are clustered.
         //
-	Vector<IntVect> tagvec;
-	tags.collate(tagvec);
+        BoxList new_bx;
+        BoxList kept_bx;
+        long numtags = 0;
+        {
+            BoxDomain bd;
+            bd.add(p_n[levc]);
+
+            if (incremental_regrid && levf <= finest_level && !useFixedCoarseGrids())
+            {
+                Vector<IntVect> tagvec;
+                tags.collate(tagvec);
+                numtags = tagvec.size();
+
+                if (numtags > 0)
+                {
+                    const IntVect crse_ratio = ref_ratio[levc]*bf_lev[levc];
+                    kept_bx = KeptGrids(grids[levf], crse_ratio, BoxArray(p_n[levc]), tagvec);
+
+                    if (!tagvec.empty())
+                    {
+                        ClusterList clist(&tagvec[0], tagvec.size());
+                        clist.chop(grid_eff);
+                        clist.intersect(bd);
+                        if (kept_bx.isNotEmpty()) {
+                            clist.exclude(BoxArray(BoxList(kept_bx).coarsen(crse_ratio)));
+                        }
+                        clist.boxList(new_bx);
+                    }
+                }
+            }
+            else if (distributed_clustering)
+            {
+                numtags = tags.cluster(new_bx, grid_eff, bd);
+            }
+            else
+            {
+                //
+                // Create initial cluster containing all tagged points.
+                //
+                Vector<IntVect> tagvec;
+                tags.collate(tagvec);
+                numtags = tagvec.size();
+
+                if (numtags > 0)
+                {
+                    ClusterList clist(&tagvec[0], tagvec.size());
+                    clist.chop(grid_eff);
+                    clist.intersect(bd);
+                    clist.boxList(new_bx);
+                }
+            }
+        }
         tags.clear();
 
-        if (tagvec.size() > 0)
+        if (numtags > 0)
         {
             //
             // Created new level, now generate efficient grids.
@@ -633,20 +745,8 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
                 new_finest = std::max(new_finest,levf);
 	    }
             //
-            // Construct initial cluster.
-            //
-            ClusterList clist(&tagvec[0], tagvec.size());
-            clist.chop(grid_eff);
-            BoxDomain bd;
-            bd.add(p_n[levc]);
-            clist.intersect(bd);
-            bd.clear();
+            // Generate list of grids at level levf.
             //
-            // Efficient properly nested Clusters have been constructed
-            // now generate list of grids at level levf.
-            //
-            BoxList new_bx;
-            clist.boxList(new_bx);
             new_bx.refine(bf_lev[levc]);
             new_bx.simplify();
             BL_ASSERT(new_bx.isDisjoint());
@@ -677,6 +777,14 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
 		}
 	    }
 
+            //
+            // The kept grids come first, in their old order.
+            //
+            if (kept_bx.isNotEmpty()) {
+                kept_bx.join(new_bx);
+                new_bx = kept_bx;
+            }
+
             if(levf > useFixedUpToLevel()) {
               new_grids[levf].define(new_bx);
 	    }
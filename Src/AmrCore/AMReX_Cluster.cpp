@@ -468,4 +468,36 @@ ClusterList::intersect (const BoxDomain& dom)
     }
 }
 
+void
+ClusterList::exclude (const BoxArray& ba)
+{
+    for (std::list<Cluster*>::iterator cli = lst.begin(); cli != lst.end(); )
+    {
+        Cluster* c = *cli;
+
+        if (!ba.intersects(c->box()))
+        {
+            ++cli;
+        }
+        else
+        {
+            BoxDomain bxdom;
+            for (const Box& b : ba.complementIn(c->box())) {
+                bxdom.add(b);
+            }
+
+            if (bxdom.size() > 0)
+            {
+                ClusterList clst;
+                c->distribute(clst,bxdom);
+                lst.splice(lst.end(),clst.lst);
+            }
+
+            delete c;
+
+            lst.erase(cli++);
+        }
+    }
+}
+
 }
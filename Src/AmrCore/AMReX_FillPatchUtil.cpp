@@ -1,8 +1,10 @@
 #include <AMReX_Utility.H>
 #include <AMReX_FillPatchUtil.H>
 #include <AMReX_FillPatchUtil_F.H>
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <map>
 
 #ifdef AMREX_USE_EB
 #include <AMReX_EBFabFactory.H>
@@ -14,6 +16,126 @@
 
 namespace amrex
 {
+    namespace
+    {
+        //
+        // The MultiFabs between FillPatchBeginReuse and FillPatchEndReuse,
+        // with the stamp of the copies of their data in the FPinfos.
+        //
+        std::map<const FabArrayBase*,long> reuse_stamps;
+        long reuse_count = 0;
+
+        long ReuseStamp (const FabArrayBase* src)
+        {
+            auto it = reuse_stamps.find(src);
+            return (it == reuse_stamps.end()) ? -1 : it->second;
+        }
+
+        //
+        // Free the copies of coarse data kept in fpc that have changed
+        // since or have left the reuse region, and the coarse patch of fpc
+        // if there are none left.
+        //
+        void FreeStaleCrseData (const FabArrayBase::FPinfo& fpc)
+        {
+            auto& kept = fpc.m_crse_data;
+            kept.erase(std::remove_if(kept.begin(), kept.end(),
+                                      [] (const FabArrayBase::FPinfo::CrseData& cd)
+                                      { return cd.stamp != ReuseStamp(cd.src); }),
+                       kept.end());
+            if (kept.empty()) fpc.m_crse_patch.reset();
+        }
+
+        //
+        // The coarse patch of fpc with at least ncomp components, which is
+        // kept in fpc while its coarse data are reused.
+        //
+        MultiFab& CrsePatch (const FabArrayBase::FPinfo& fpc, int ncomp)
+        {
+            if (fpc.m_crse_patch == nullptr || fpc.m_crse_patch->nComp() < ncomp)
+            {
+                fpc.m_crse_patch.reset(new MultiFab(fpc.ba_crse_patch, fpc.dm_crse_patch,
+                                                    ncomp, 0, MFInfo(), *fpc.fact_crse_patch));
+            }
+            return *fpc.m_crse_patch;
+        }
+
+        //
+        // Components [scomp,scomp+ncomp) of cmf copied to the layout of the
+        // coarse patch of fpc.  The copy is kept in fpc until cmf leaves the
+        // reuse region.
+        //
+        const MultiFab& KeptCrseData (const FabArrayBase::FPinfo& fpc, const MultiFab& cmf,
+                                      int scomp, int ncomp, const Geometry& cgeom)
+        {
+            const long stamp = ReuseStamp(&cmf);
+            const FabArrayBase::BDKey& bdk = cmf.getBDKey();
+
+            auto& kept = fpc.m_crse_data;
+
+            for (const auto& cd : kept) {
+                if (cd.src == &cmf && cd.srcbdk == bdk && cd.scomp == scomp && cd.ncomp == ncomp) {
+                    return *cd.mf;
+                }
+            }
+
+            std::unique_ptr<MultiFab> mf(new MultiFab(fpc.ba_crse_patch, fpc.dm_crse_patch,
+                                                      ncomp, 0, MFInfo(), *fpc.fact_crse_patch));
+            mf->setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), cgeom);
+            mf->copy(cmf, scomp, 0, ncomp, cgeom.periodicity());
+
+            kept.push_back({&cmf, bdk, scomp, ncomp, stamp, std::move(mf)});
+            return *kept.back().mf;
+        }
+
+        //
+        // Like FillPatchSingleLevel, but interpolates in time the coarse
+        // data kept on the layout of mf instead of copying them again.
+        //
+        void FillCrsePatchFromKept (MultiFab& mf, const FabArrayBase::FPinfo& fpc, Real time,
+                                    const Vector<MultiFab*>& cmf, const Vector<Real>& ct,
+                                    int scomp, int ncomp,
+                                    const Geometry& cgeom, PhysBCFunctBase& cbc)
+        {
+            if (cmf.size() == 1)
+            {
+                MultiFab::Copy(mf, KeptCrseData(fpc, *cmf[0], scomp, ncomp, cgeom), 0, 0, ncomp, 0);
+            }
+            else
+            {
+                const MultiFab& c0 = KeptCrseData(fpc, *cmf[0], scomp, ncomp, cgeom);
+                const MultiFab& c1 = KeptCrseData(fpc, *cmf[1], scomp, ncomp, cgeom);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+                for (MFIter mfi(mf,true); mfi.isValid(); ++mfi)
+                {
+                    const Box& bx = mfi.tilebox();
+                    mf[mfi].linInterp(c0[mfi], 0, c1[mfi], 0, ct[0], ct[1], time, bx, 0, ncomp);
+                }
+            }
+
+            cbc.FillBoundary(mf, 0, ncomp, time);
+        }
+    }
+
+    void FillPatchBeginReuse (const Vector<const MultiFab*>& cmf)
+    {
+        for (const MultiFab* mf : cmf) {
+            reuse_stamps[mf] = reuse_count++;
+        }
+    }
+
+    void FillPatchEndReuse (const Vector<const MultiFab*>& cmf)
+    {
+        for (const MultiFab* mf : cmf) {
+            reuse_stamps.erase(mf);
+        }
+        for (const auto& kv : FabArrayBase::m_TheFillPatchCache) {
+            FreeStaleCrseData(*kv.second);
+        }
+    }
+
     bool ProperlyNested (const IntVect& ratio, const IntVect& blocking_factor, int ngrow,
 			 const IndexType& boxType, Interpolater* mapper)
     {
@@ -163,12 +285,27 @@ namespace amrex
 
 	    if ( ! fpc.ba_crse_patch.empty())
 	    {
-		MultiFab mf_crse_patch(fpc.ba_crse_patch, fpc.dm_crse_patch, ncomp, 0, MFInfo(),
-                                       *fpc.fact_crse_patch);
+                bool reuse = cmf.size() <= 2;
+                for (const MultiFab* c : cmf) {
+                    reuse = reuse && ReuseStamp(c) >= 0;
+                }
+
+                std::unique_ptr<MultiFab> raii_crse_patch;
+                if (reuse) {
+                    FreeStaleCrseData(fpc);
+                } else {
+                    raii_crse_patch.reset(new MultiFab(fpc.ba_crse_patch, fpc.dm_crse_patch,
+                                                       ncomp, 0, MFInfo(), *fpc.fact_crse_patch));
+                }
+		MultiFab& mf_crse_patch = reuse ? CrsePatch(fpc, ncomp) : *raii_crse_patch;
 		
                 mf_crse_patch.setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), cgeom);
 
-		FillPatchSingleLevel(mf_crse_patch, time, cmf, ct, scomp, 0, ncomp, cgeom, cbc);
+                if (reuse) {
+                    FillCrsePatchFromKept(mf_crse_patch, fpc, time, cmf, ct, scomp, ncomp, cgeom, cbc);
+                } else {
+                    FillPatchSingleLevel(mf_crse_patch, time, cmf, ct, scomp, 0, ncomp, cgeom, cbc);
+                }
 		
 		int idummy1=0, idummy2=0;
 		bool cc = fpc.ba_crse_patch.ixType().cellCentered();
@@ -400,17 +400,62 @@ FluxRegister::Reflux (MultiFab&       mf,
 {
     BL_PROFILE("FluxRegister::Reflux()");
 
+    Reflux_nowait(mf,volume,scale,scomp,dcomp,nc,geom);
+    Reflux_finish();
+}
+
+void 
+FluxRegister::Reflux_nowait (MultiFab&       mf,
+                             const MultiFab& volume,
+                             Real            scale,
+                             int             scomp,
+                             int             dcomp,
+                             int             nc,
+                             const Geometry& geom)
+{
+    BL_PROFILE("FluxRegister::Reflux_nowait()");
+
+    BL_ASSERT(rf_mf == nullptr);
+
+    rf_mf     = &mf;
+    rf_volume = &volume;
+    rf_scale  = scale;
+    rf_dcomp  = dcomp;
+    rf_nc     = nc;
+
+    rf_flux.resize(2*AMREX_SPACEDIM);
+
     for (OrientationIter fi; fi; ++fi)
     {
 	const Orientation& face = fi();
 	int idir = face.coordDir();
-	int islo = face.isLow();
 
-        MultiFab flux(amrex::convert(mf.boxArray(), IntVect::TheDimensionVector(idir)),
-                      mf.DistributionMap(), nc, 0, MFInfo(), mf.Factory());
-	flux.setVal(0.0);
+        rf_flux[face].reset(new MultiFab(amrex::convert(mf.boxArray(), IntVect::TheDimensionVector(idir)),
+                                         mf.DistributionMap(), nc, 0, MFInfo(), mf.Factory()));
+	rf_flux[face]->setVal(0.0);
 
-	bndry[face].copyTo(flux, 0, scomp, 0, nc, geom.periodicity());
+	bndry[face].copyTo_nowait(*rf_flux[face], 0, scomp, 0, nc, geom.periodicity());
+    }
+}
+
+void 
+FluxRegister::Reflux_finish ()
+{
+    BL_PROFILE("FluxRegister::Reflux_finish()");
+
+    BL_ASSERT(rf_mf != nullptr);
+
+    MultiFab&       mf     = *rf_mf;
+    const MultiFab& volume = *rf_volume;
+
+    for (OrientationIter fi; fi; ++fi)
+    {
+	const Orientation& face = fi();
+	int idir = face.coordDir();
+	int islo = face.isLow();
+
+	MultiFab& flux = *rf_flux[face];
+	flux.ParallelCopy_finish();
 
 #ifdef _OPENMP
 #pragma omp parallel
@@ -429,13 +474,19 @@ FluxRegister::Reflux (MultiFab&       mf,
 	    const Box& vbox = vfab.box();
 
 	    FORT_FRREFLUX(bx.loVect(), bx.hiVect(),
-			  sfab.dataPtr(dcomp), sbox.loVect(), sbox.hiVect(),
-			  ffab.dataPtr(     ), fbox.loVect(), fbox.hiVect(),
-			  vfab.dataPtr(     ), vfab.loVect(), vbox.hiVect(),
-			  &nc, &scale, &idir, &islo);
+			  sfab.dataPtr(rf_dcomp), sbox.loVect(), sbox.hiVect(),
+			  ffab.dataPtr(        ), fbox.loVect(), fbox.hiVect(),
+			  vfab.dataPtr(        ), vfab.loVect(), vbox.hiVect(),
+			  &rf_nc, &rf_scale, &idir, &islo);
 			  
 	}
+
+	rf_flux[face].reset();
     }
+
+    rf_mf     = nullptr;
+    rf_volume = nullptr;
+    rf_cvolume.clear();
 }
 
 void 
@@ -456,6 +507,24 @@ FluxRegister::Reflux (MultiFab&       mf,
     Reflux(mf,volume,scale,scomp,dcomp,nc,geom);
 }
 
+void 
+FluxRegister::Reflux_nowait (MultiFab&       mf,
+                             Real            scale,
+                             int             scomp,
+                             int             dcomp,
+                             int             nc,
+                             const Geometry& geom)
+{
+    const Real* dx = geom.CellSize();
+
+    rf_cvolume.define(mf.boxArray(), mf.DistributionMap(), 1, mf.nGrow(),
+                      MFInfo(), mf.Factory());
+
+    rf_cvolume.setVal(AMREX_D_TERM(dx[0],*dx[1],*dx[2]), 0, 1, mf.nGrow());
+
+    Reflux_nowait(mf,rf_cvolume,scale,scomp,dcomp,nc,geom);
+}
+
 void
 FluxRegister::ClearInternalBorders (const Geometry& geom)
 {
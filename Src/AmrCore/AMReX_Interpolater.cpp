@@ -5,6 +5,9 @@
 #include <AMReX_Geometry.H>
 #include <AMReX_Interpolater.H>
 #include <AMReX_INTERP_F.H>
+#if (AMREX_SPACEDIM == 3)
+#include <AMReX_Interp_3D_C.H>
+#endif
 
 namespace amrex {
 
@@ -25,6 +28,22 @@ CellConservativeLinear    cell_cons_interp(0);
 CellConservativeProtected protected_interp;
 CellConservativeQuartic   quartic_interp;
 
+bool Interpolater::use_fortran = false;
+
+namespace {
+    //
+    // The ratio if it is 2 or 4 in all directions and 0 otherwise.
+    //
+    int cpp_kernel_ratio (const IntVect& ratio)
+    {
+        if (Interpolater::use_fortran) return 0;
+        for (int d = 1; d < AMREX_SPACEDIM; ++d) {
+            if (ratio[d] != ratio[0]) return 0;
+        }
+        return (ratio[0] == 2 || ratio[0] == 4) ? ratio[0] : 0;
+    }
+}
+
 Interpolater::~Interpolater () {}
 
 InterpolaterBoxCoarsener
@@ -102,6 +121,17 @@ NodeBilinear::interp (const FArrayBox&  crse,
                       int               actual_state)
 {
     BL_PROFILE("NodeBilinear::interp()");
+#if (AMREX_SPACEDIM == 3)
+    switch (cpp_kernel_ratio(ratio))
+    {
+    case 2:
+        node_bilinear_interp_3d<2>(crse, crse_comp, fine, fine_comp, ncomp);
+        return;
+    case 4:
+        node_bilinear_interp_3d<4>(crse, crse_comp, fine, fine_comp, ncomp);
+        return;
+    }
+#endif
     //
     // Set up to call FORTRAN.
     //
@@ -299,6 +329,43 @@ CellConservativeLinear::interp (const FArrayBox& crse,
         fine_geom.GetEdgeVolCoord(fvc[dir],fine_version_of_cslope_bx,dir);
         crse_geom.GetEdgeVolCoord(cvc[dir],crse_bx,dir);
     }
+#if (AMREX_SPACEDIM == 3)
+    const int rr = cpp_kernel_ratio(ratio);
+    if (rr > 0 && target_fine_region.ok())
+    {
+        //
+        // The offsets of the fine cells from the centers of their coarse
+        // cells, in units of the coarse cell size, as in FORT_LINCCINTERP.
+        //
+        Vector<Real> voff[AMREX_SPACEDIM];
+        const Real* vp[AMREX_SPACEDIM];
+        for (dir = 0; dir < AMREX_SPACEDIM; dir++)
+        {
+            const int flo = fine_version_of_cslope_bx.smallEnd(dir);
+            const int clo = crse_bx.smallEnd(dir);
+            const Vector<Real>& fv = fvc[dir];
+            const Vector<Real>& cv = cvc[dir];
+            voff[dir].resize(fine_version_of_cslope_bx.length(dir));
+            for (int i = 0; i < voff[dir].size(); i++)
+            {
+                const int ic = interp_detail::coarsen_index(flo+i,rr) - clo;
+                const Real fcen = 0.5*(fv[i]+fv[i+1]);
+                const Real ccen = 0.5*(cv[ic]+cv[ic+1]);
+                voff[dir][i] = (fcen-ccen)/(cv[ic+1]-cv[ic]);
+            }
+            vp[dir] = voff[dir].dataPtr();
+        }
+        const Vector<int>& bc = GetBCArray(bcr);
+        if (rr == 2) {
+            lincc_interp_3d<2>(fine, fine_comp, crse, crse_comp, ncomp, target_fine_region,
+                               cslope_bx, vp, bc.dataPtr(), do_linear_limiting);
+        } else {
+            lincc_interp_3d<4>(fine, fine_comp, crse, crse_comp, ncomp, target_fine_region,
+                               cslope_bx, vp, bc.dataPtr(), do_linear_limiting);
+        }
+        return;
+    }
+#endif
     //
     // alloc tmp space for slope calc.
     //
@@ -4,6 +4,8 @@
 #include <climits>
 
 #include <AMReX_TagBox.H>
+#include <AMReX_Cluster.H>
+#include <AMReX_BoxDomain.H>
 #include <AMReX_Geometry.H>
 #include <AMReX_ParallelDescriptor.H>
 #include <AMReX_BLProfiler.H>
@@ -11,6 +13,82 @@
 
 namespace amrex {
 
+namespace {
+
+//
+// Bits of a tag used as scratch space by TagBox::buffer, above the values
+// of TagBox::TagVal: the cells to buffer around, and the buffered cells.
+// buf_mark is buf_seed shifted by one bit.
+//
+const TagBox::TagType buf_seed = 0x10;
+const TagBox::TagType buf_mark = 0x20;
+
+//
+// Marks the cells of p, of lengths len, within nbuff cells in direction
+// dir of a seed cell, and then makes the marked cells the seeds.  Along
+// the first direction, each row ORs its shifts into a row accumulator.
+// Along the others, each row or plane ORs in the seeds of those within
+// nbuff of it.  Either way the compiler does many cells at a time, and
+// since the seeds and the marks are different bits, p is marked in place.
+//
+void
+dilate (TagBox::TagType* p, const int* len, int dir, int nbuff)
+{
+    typedef TagBox::TagType TagType;
+
+    const long npts = long(len[0])*len[1]*len[2];
+
+    if (dir == 0)
+    {
+        Vector<TagType> acc(len[0]);
+        TagType* a = acc.dataPtr();
+        for (long r = 0; r < npts; r += len[0])
+        {
+            TagType* t = p + r;
+            std::fill(acc.begin(), acc.end(), TagBox::CLEAR);
+            for (int m = -nbuff; m <= nbuff; ++m)
+            {
+                const int ilo = std::max(0, -m);
+                const int ihi = std::min(len[0], len[0]-m);
+                const TagType* s = t + m;
+                for (int i = ilo; i < ihi; ++i) a[i] |= s[i];
+            }
+            for (int i = 0; i < len[0]; ++i) t[i] |= (a[i] & buf_seed) << 1;
+        }
+    }
+    else
+    {
+        const long inner = (dir == 1) ? len[0] : long(len[0])*len[1];
+        const int  n     = len[dir];
+        const long outer = npts / (inner*n);
+        for (long o = 0; o < outer; ++o)
+        {
+            TagType* line = p + o*n*inner;
+            for (int l = 0; l < n; ++l)
+            {
+                TagType* t = line + l*inner;
+                const int lo = std::max(0, l-nbuff);
+                const int hi = std::min(n-1, l+nbuff);
+                for (int m = lo; m <= hi; ++m)
+                {
+                    if (m == l) {
+                        for (long i = 0; i < inner; ++i) t[i] |= (t[i] & buf_seed) << 1;
+                    } else {
+                        const TagType* s = line + m*inner;
+                        for (long i = 0; i < inner; ++i) t[i] |= (s[i] & buf_seed) << 1;
+                    }
+                }
+            }
+        }
+    }
+
+    for (long i = 0; i < npts; ++i) {
+        p[i] = (p[i] & ~(buf_seed|buf_mark)) | ((p[i] & buf_mark) >> 1);
+    }
+}
+
+}
+
 TagBox::TagBox () {}
 
 TagBox::TagBox (const Box& bx,
@@ -28,77 +106,69 @@ TagBox::coarsen (const IntVect& ratio, bool owner)
 {
     BL_ASSERT(nComp() == 1);
 
-    TagType*   fdat     = dataPtr();
-    IntVect    lov      = domain.smallEnd();
-    IntVect    hiv      = domain.bigEnd();
-    IntVect    d_length = domain.size();
-    const int* flo      = lov.getVect();
-    const int* fhi      = hiv.getVect();
-    const int* flen     = d_length.getVect();
+    const Box fbox = domain;
+    const Box& cbox = amrex::coarsen(fbox,ratio);
+
+    if (!owner)
+    {
+        this->resize(cbox);
+        return;
+    }
+
+    int flo[3] = {0,0,0}, flen[3] = {1,1,1}, clo[3] = {0,0,0}, clen[3] = {1,1,1}, r[3] = {1,1,1};
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        flo[d]  = fbox.smallEnd(d);
+        flen[d] = fbox.length(d);
+        clo[d]  = cbox.smallEnd(d);
+        clen[d] = cbox.length(d);
+        r[d]    = ratio[d];
+    }
+    //
+    // For each coarse row, the fine rows over it are ORed, which the
+    // compiler does many bytes at a time.  Since SET and BUF are different
+    // bits, a coarse cell then gets the largest tag of its fine cells.
+    //
+    Vector<TagType> acc(flen[0]);
+    Vector<TagType> cfab(cbox.numPts());
+    const TagType* fdat = dataPtr();
 
-    const Box& cbox = amrex::coarsen(domain,ratio);
+    for (int kc = 0; kc < clen[2]; ++kc)
+    {
+        const int klo = std::max((clo[2]+kc)*r[2], flo[2]) - flo[2];
+        const int khi = std::min((clo[2]+kc+1)*r[2], flo[2]+flen[2]) - flo[2];
+        for (int jc = 0; jc < clen[1]; ++jc)
+        {
+            const int jlo = std::max((clo[1]+jc)*r[1], flo[1]) - flo[1];
+            const int jhi = std::min((clo[1]+jc+1)*r[1], flo[1]+flen[1]) - flo[1];
+
+            TagType* a = acc.dataPtr();
+            std::fill(acc.begin(), acc.end(), TagBox::CLEAR);
+            for (int k = klo; k < khi; ++k) {
+                for (int j = jlo; j < jhi; ++j) {
+                    const TagType* row = fdat + (long(k)*flen[1] + j)*flen[0];
+                    for (int i = 0; i < flen[0]; ++i) a[i] |= row[i];
+                }
+            }
+
+            TagType* c = cfab.dataPtr() + (long(kc)*clen[1] + jc)*clen[0];
+            for (int ic = 0; ic < clen[0]; ++ic)
+            {
+                const int ilo = std::max((clo[0]+ic)*r[0], flo[0]) - flo[0];
+                const int ihi = std::min((clo[0]+ic+1)*r[0], flo[0]+flen[0]) - flo[0];
+                TagType v = TagBox::CLEAR;
+                for (int i = ilo; i < ihi; ++i) v |= a[i];
+                c[ic] = (v & TagBox::SET) ? TagBox::SET
+                      : (v != TagBox::CLEAR) ? TagBox::BUF : TagBox::CLEAR;
+            }
+        }
+    }
 
     this->resize(cbox);
 
-    if (!owner) return;
-
-    const int* clo      = cbox.loVect();
-    IntVect    cbox_len = cbox.size();
-    const int* clen     = cbox_len.getVect();
-
-    Box b1(amrex::refine(cbox,ratio));
-    const int* lo       = b1.loVect();
-    int        longlen  = b1.longside();
-
-    Vector<TagType> cfab(numpts);
-    TagType* cdat = cfab.dataPtr();
-
-    Vector<TagType> t(longlen,TagBox::CLEAR);
-
-    int klo = 0, khi = 0, jlo = 0, jhi = 0, ilo, ihi;
-    AMREX_D_TERM(ilo=flo[0]; ihi=fhi[0]; ,
-           jlo=flo[1]; jhi=fhi[1]; ,
-           klo=flo[2]; khi=fhi[2];)
-
-#define IXPROJ(i,r) (((i)+(r)*std::abs(i))/(r) - std::abs(i))
-#define IOFF(j,k,lo,len) AMREX_D_TERM(0, +(j-lo[1])*len[0], +(k-lo[2])*len[0]*len[1])
-   
-   int ratiox = 1, ratioy = 1, ratioz = 1;
-   AMREX_D_TERM(ratiox = ratio[0];,
-          ratioy = ratio[1];,
-          ratioz = ratio[2];)
-
-   for (int k = klo; k <= khi; k++)
-   {
-       const int kc = IXPROJ(k,ratioz);
-       for (int j = jlo; j <= jhi; j++)
-       {
-           const int     jc = IXPROJ(j,ratioy);
-           TagType*       c = cdat + IOFF(jc,kc,clo,clen);
-           const TagType* f = fdat + IOFF(j,k,flo,flen);
-           //
-           // Copy fine grid row of values into tmp array.
-           //
-           for (int i = ilo; i <= ihi; i++)
-               t[i-lo[0]] = f[i-ilo];
-
-           for (int off = 0; off < ratiox; off++)
-           {
-               for (int ic = 0; ic < clen[0]; ic++)
-               {
-                   const int i = ic*ratiox + off;
-                   c[ic] = std::max(c[ic],t[i]);
-               }
-           }
-       }
-   }
-
-#undef IXPROJ
-#undef IOFF
-
-   for (int i = 0; i < numpts; ++i) {
-       fdat[i] = cdat[i];
-   }
+    TagType* dat = dataPtr();
+    for (long i = 0; i < numpts; ++i) {
+        dat[i] = cfab[i];
+    }
 }
 
 void 
@@ -111,48 +181,44 @@ TagBox::buffer (int nbuff,
     //
     Box inside(domain);
     inside.grow(-nwid);
-    const int* inlo = inside.loVect();
-    const int* inhi = inside.hiVect();
-    int klo = 0, khi = 0, jlo = 0, jhi = 0, ilo, ihi;
-    AMREX_D_TERM(ilo=inlo[0]; ihi=inhi[0]; ,
-           jlo=inlo[1]; jhi=inhi[1]; ,
-           klo=inlo[2]; khi=inhi[2];)
 
-    IntVect d_length = domain.size();
-    const int* len = d_length.getVect();
-    const int* lo = domain.loVect();
-    int ni = 0, nj = 0, nk = 0;
-    AMREX_D_TERM(ni, =nj, =nk) = nbuff;
+    if (nbuff <= 0) return;
+
+    int ilo[3] = {0,0,0}, ihi[3] = {0,0,0}, lo[3] = {0,0,0}, len[3] = {1,1,1};
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        ilo[d] = inside.smallEnd(d);
+        ihi[d] = inside.bigEnd(d);
+        lo[d]  = domain.smallEnd(d);
+        len[d] = domain.length(d);
+    }
+    //
+    // The SET cells inside are the seeds, which are dilated by a cube one
+    // direction at a time in the scratch bits of the tags themselves.
+    // The dilated cells that are not SET then become BUF.
+    //
     TagType* d = dataPtr();
 
-#define OFF(i,j,k,lo,len) AMREX_D_TERM(i-lo[0], +(j-lo[1])*len[0] , +(k-lo[2])*len[0]*len[1])
-   
-    for (int k = klo; k <= khi; k++)
-    {
-        for (int j = jlo; j <= jhi; j++)
-        {
-            for (int i = ilo; i <= ihi; i++)
-            {
-                TagType* d_check = d + OFF(i,j,k,lo,len);
-                if (*d_check == TagBox::SET)
-                {
-                    for (int kk = -nk; kk <= nk; kk++)
-                    {
-                        for (int jj = -nj; jj <= nj; jj++)
-                        {
-                            for (int ii = -ni; ii <= ni; ii++)
-                            {
-                                TagType* dn = d_check+ AMREX_D_TERM(ii, +jj*len[0], +kk*len[0]*len[1]);
-                                if (*dn !=TagBox::SET)
-                                    *dn = TagBox::BUF;
-                            }
-                        }
-                    }
-                }
+    int nseeds = 0;
+    for (int k = ilo[2]; k <= ihi[2]; ++k) {
+        for (int j = ilo[1]; j <= ihi[1]; ++j) {
+            TagType* row = d + (long(k-lo[2])*len[1] + (j-lo[1]))*len[0] - lo[0];
+            for (int i = ilo[0]; i <= ihi[0]; ++i) {
+                nseeds += (row[i] == TagBox::SET);
+                row[i] |= (row[i] == TagBox::SET) ? buf_seed : 0;
             }
         }
     }
-#undef OFF
+
+    if (nseeds == 0) return;
+
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        dilate(d, len, dir, nbuff);
+    }
+
+    for (long n = 0; n < numpts; ++n) {
+        const TagType v = d[n] & ~buf_seed;
+        d[n] = (d[n] & buf_seed) ? ((v == TagBox::SET) ? TagBox::SET : TagBox::BUF) : v;
+    }
 }
 
 void 
@@ -490,11 +556,9 @@ TagBoxArray::numTags () const
     return ntag;
 }
 
-void
-TagBoxArray::collate (Vector<IntVect>& TheGlobalCollateSpace) const
+long
+TagBoxArray::local_collate (Vector<IntVect>& TheLocalCollateSpace) const
 {
-    BL_PROFILE("TagBoxArray::collate()");
-
     long count = 0;
 
 #ifdef _OPENMP
@@ -505,10 +569,7 @@ TagBoxArray::collate (Vector<IntVect>& TheGlobalCollateSpace) const
         count += get(fai).numTags();
     }
 
-    //
-    // Local space for holding just those tags we want to gather to the root cpu.
-    //
-    Vector<IntVect> TheLocalCollateSpace(count);
+    TheLocalCollateSpace.resize(count);
 
     count = 0;
 
@@ -523,6 +584,20 @@ TagBoxArray::collate (Vector<IntVect>& TheGlobalCollateSpace) const
         amrex::RemoveDuplicates(TheLocalCollateSpace);
 	count = TheLocalCollateSpace.size();
     }
+
+    return count;
+}
+
+void
+TagBoxArray::collate (Vector<IntVect>& TheGlobalCollateSpace) const
+{
+    BL_PROFILE("TagBoxArray::collate()");
+
+    //
+    // Local space for holding just those tags we want to gather to the root cpu.
+    //
+    Vector<IntVect> TheLocalCollateSpace;
+    long count = local_collate(TheLocalCollateSpace);
     //
     // The total number of tags system wide that must be collated.
     // This is really just an estimate of the upper bound due to duplicates.
@@ -589,6 +664,150 @@ TagBoxArray::collate (Vector<IntVect>& TheGlobalCollateSpace) const
 #endif
 }
 
+namespace {
+
+//
+// Adds the parts of the disjoint boxes of b that are not in the disjoint
+// boxes of a to a, so that a remains disjoint.
+//
+void
+join_disjoint (BoxList& a, const BoxList& b)
+{
+    if (a.isEmpty()) {
+        a = b;
+        return;
+    }
+
+    const BoxArray aba(a);
+
+    for (const Box& bx : b)
+    {
+        const std::vector< std::pair<int,Box> >& isects = aba.intersections(bx);
+
+        if (isects.empty())
+        {
+            a.push_back(bx);
+        }
+        else
+        {
+            BoxList covered;
+            for (const auto& is : isects) {
+                covered.push_back(is.second);
+            }
+            BoxList rest = amrex::complementIn(bx, covered);
+            a.catenate(rest);
+        }
+    }
+}
+
+#if BL_USE_MPI
+Vector<int>
+serialize_boxes (const BoxList& bl)
+{
+    Vector<int> buf;
+    buf.reserve(2*AMREX_SPACEDIM*bl.size());
+    for (const Box& bx : bl)
+    {
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) buf.push_back(bx.smallEnd(d));
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) buf.push_back(bx.bigEnd(d));
+    }
+    return buf;
+}
+
+BoxList
+unserialize_boxes (const Vector<int>& buf)
+{
+    BoxList bl;
+    for (int i = 0; i < buf.size(); i += 2*AMREX_SPACEDIM)
+    {
+        const IntVect lo(&buf[i]);
+        const IntVect hi(&buf[i+AMREX_SPACEDIM]);
+        bl.push_back(Box(lo,hi));
+    }
+    return bl;
+}
+#endif
+
+}
+
+long
+TagBoxArray::cluster (BoxList& bl, Real eff, const BoxDomain& bd) const
+{
+    BL_PROFILE("TagBoxArray::cluster()");
+
+    bl.clear();
+
+    Vector<IntVect> TheLocalCollateSpace;
+    long numtags = local_collate(TheLocalCollateSpace);
+
+    if (numtags > 0)
+    {
+        ClusterList clist(&TheLocalCollateSpace[0], numtags);
+        clist.chop(eff);
+        clist.intersect(bd);
+        clist.boxList(bl);
+    }
+
+    ParallelDescriptor::ReduceLongSum(numtags);
+
+    if (numtags == 0) {
+        bl.clear();
+        return 0;
+    }
+
+#if BL_USE_MPI
+    //
+    // Merge the boxes in a binary tree rooted at CPU 0.  At each step,
+    // the CPUs that are odd multiples of step send their boxes to the CPU
+    // step below them.
+    //
+    const int nprocs = ParallelDescriptor::NProcs();
+    const int myproc = ParallelDescriptor::MyProc();
+    const int seqno  = ParallelDescriptor::SeqNum();
+
+    for (int step = 1; step < nprocs; step *= 2)
+    {
+        if (myproc % (2*step) == step)
+        {
+            const Vector<int>& buf = serialize_boxes(bl);
+            const int n = buf.size();
+            ParallelDescriptor::Send(&n, 1, myproc-step, seqno);
+            if (n > 0) {
+                ParallelDescriptor::Send(buf.dataPtr(), n, myproc-step, seqno);
+            }
+            break;
+        }
+        else if (myproc % (2*step) == 0 && myproc+step < nprocs)
+        {
+            int n = 0;
+            ParallelDescriptor::Recv(&n, 1, myproc+step, seqno);
+            if (n > 0)
+            {
+                Vector<int> buf(n);
+                ParallelDescriptor::Recv(buf.dataPtr(), n, myproc+step, seqno);
+                join_disjoint(bl, unserialize_boxes(buf));
+                bl.simplify();
+            }
+        }
+    }
+
+    Vector<int> buf;
+    int n = 0;
+    if (myproc == 0) {
+        buf = serialize_boxes(bl);
+        n = buf.size();
+    }
+    ParallelDescriptor::Bcast(&n, 1, 0);
+    buf.resize(n);
+    if (n > 0) {
+        ParallelDescriptor::Bcast(buf.dataPtr(), n, 0);
+    }
+    bl = unserialize_boxes(buf);
+#endif
+
+    return numtags;
+}
+
 void
 TagBoxArray::setVal (const BoxList& bl,
                      TagBox::TagVal val)
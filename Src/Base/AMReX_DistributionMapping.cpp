@@ -2600,8 +2600,31 @@ DistributionMapping::TranslateProcMap(const Vector<int> &pm_old, const MPI_Group
 }
 #endif
 
+//
+// Scales the costs to the integer weights of the processor maps.  If no
+// cost is positive, e.g., the particle costs of a level without particles,
+// all the boxes get the same weight.
+//
+static
+void
+scaleCosts (const Vector<Real>& rcost, Vector<long>& cost)
+{
+    const Real wmax = rcost.empty() ? 0.0 : *std::max_element(rcost.begin(), rcost.end());
+
+    if (wmax <= 0.0) {
+        std::fill(cost.begin(), cost.end(), 1L);
+        return;
+    }
+
+    const Real scale = 1.e9/wmax;
+
+    for (int i = 0, N = rcost.size(); i < N; ++i) {
+        cost[i] = long(rcost[i]*scale) + 1L;
+    }
+}
+
 DistributionMapping
-DistributionMapping::makeKnapSack (const Vector<Real>& rcost)
+DistributionMapping::makeKnapSack (const Vector<Real>& rcost, int nmax)
 {
     BL_PROFILE("makeKnapSack");
 
@@ -2609,17 +2632,12 @@ DistributionMapping::makeKnapSack (const Vector<Real>& rcost)
 
     Vector<long> cost(rcost.size());
 
-    Real wmax = *std::max_element(rcost.begin(), rcost.end());
-    Real scale = 1.e9/wmax;
-
-    for (int i = 0; i < rcost.size(); ++i) {
-        cost[i] = long(rcost[i]*scale) + 1L;
-    }
+    scaleCosts(rcost, cost);
 
     int nprocs = ParallelDescriptor::NProcs();
     Real eff;
 
-    r.KnapSackProcessorMap(cost, nprocs, &eff, true);
+    r.KnapSackProcessorMap(cost, nprocs, &eff, true, nmax);
 
     return r;
 }
@@ -2645,12 +2663,7 @@ DistributionMapping::makeKnapSack (const MultiFab& weight, int nmax)
 
 	ParallelDescriptor::ReduceRealSum(&rcost[0], rcost.size());
 
-	Real wmax = *std::max_element(rcost.begin(), rcost.end());
-	Real scale = 1.e9/wmax;
-	
-	for (int i = 0; i < rcost.size(); ++i) {
-	    cost[i] = long(rcost[i]*scale) + 1L;
-	}
+	scaleCosts(rcost, cost);
     }
 #endif
 
@@ -2681,12 +2694,7 @@ DistributionMapping::makeRoundRobin (const MultiFab& weight)
 
 	ParallelDescriptor::ReduceRealSum(&rcost[0], rcost.size());
 
-	Real wmax = *std::max_element(rcost.begin(), rcost.end());
-	Real scale = 1.e9/wmax;
-	
-	for (int i = 0; i < rcost.size(); ++i) {
-	    cost[i] = long(rcost[i]*scale) + 1L;
-	}
+	scaleCosts(rcost, cost);
     }
 #endif
 
@@ -2717,12 +2725,7 @@ DistributionMapping::makeSFC (const MultiFab& weight,
 
 	ParallelDescriptor::ReduceRealSum(&rcost[0], rcost.size());
 
-	Real wmax = *std::max_element(rcost.begin(), rcost.end());
-	Real scale = 1.e9/wmax;
-	
-	for (int i = 0; i < rcost.size(); ++i) {
-	    cost[i] = long(rcost[i]*scale) + 1L;
-	}
+	scaleCosts(rcost, cost);
     }
 #endif
 
@@ -2733,6 +2736,116 @@ DistributionMapping::makeSFC (const MultiFab& weight,
     return r;
 }
 
+DistributionMapping
+DistributionMapping::makeSFC (const Vector<Real>& rcost, const BoxArray& boxes)
+{
+    BL_PROFILE("makeSFC");
+
+    BL_ASSERT(rcost.size() == boxes.size());
+
+    DistributionMapping r;
+
+    Vector<long> cost(rcost.size());
+
+    scaleCosts(rcost, cost);
+
+    int nprocs = ParallelDescriptor::NProcs();
+
+    r.SFCProcessorMap(boxes, cost, nprocs);
+
+    return r;
+}
+
+Vector<Real>
+DistributionMapping::makeCombinedCost (const BoxArray& ba, const Vector<long>& nparticles,
+                                       Real cell_weight, Real particle_weight,
+                                       const MultiFab* cell_cost)
+{
+    BL_PROFILE("makeCombinedCost");
+
+    BL_ASSERT(nparticles.empty() || nparticles.size() == ba.size());
+
+    Vector<Real> rcost(ba.size(), 0.0);
+
+    if (cell_cost)
+    {
+        BL_ASSERT(cell_cost->boxArray() == ba);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+	for (MFIter mfi(*cell_cost); mfi.isValid(); ++mfi) {
+	    rcost[mfi.index()] = (*cell_cost)[mfi].sum(mfi.validbox(),0);
+	}
+
+	ParallelDescriptor::ReduceRealSum(rcost.dataPtr(), rcost.size());
+    }
+    else
+    {
+        for (int i = 0; i < ba.size(); ++i) {
+            rcost[i] = static_cast<Real>(ba[i].numPts());
+        }
+    }
+
+    for (int i = 0; i < ba.size(); ++i) {
+        rcost[i] *= cell_weight;
+    }
+
+    if (!nparticles.empty()) {
+        for (int i = 0; i < ba.size(); ++i) {
+            rcost[i] += particle_weight * static_cast<Real>(nparticles[i]);
+        }
+    }
+
+    return rcost;
+}
+
+bool
+DistributionMapping::FitCostWeights (long ncells, long nparticles, Real time,
+                                     Real& cell_weight, Real& particle_weight)
+{
+    BL_PROFILE("FitCostWeights");
+    //
+    // The normal equations of the least squares problem.
+    //
+    const Real c = static_cast<Real>(ncells);
+    const Real p = static_cast<Real>(nparticles);
+
+    Real sums[5] = { c*c, c*p, p*p, c*time, p*time };
+
+    ParallelDescriptor::ReduceRealSum(sums, 5);
+
+    const Real scc = sums[0], scp = sums[1], spp = sums[2], sct = sums[3], spt = sums[4];
+
+    if (scc <= 0.0 || spp <= 0.0) {
+        return false;
+    }
+
+    const Real det = scc*spp - scp*scp;
+
+    if (det <= 1.e-8*scc*spp) {
+        return false;
+    }
+
+    Real cw = (sct*spp - spt*scp) / det;
+    Real pw = (spt*scc - sct*scp) / det;
+
+    if (cw < 0.0) {
+        cw = 0.0;
+        pw = spt / spp;
+    } else if (pw < 0.0) {
+        pw = 0.0;
+        cw = sct / scc;
+    }
+
+    if (cw <= 0.0 && pw <= 0.0) {
+        return false;
+    }
+
+    cell_weight = cw;
+    particle_weight = pw;
+
+    return true;
+}
 
 std::vector<std::vector<int> >
 DistributionMapping::makeSFC (const BoxArray& ba)
@@ -398,7 +398,16 @@ ParallelDescriptor::StartParallel (int*    argc,
     BL_MPI_REQUIRE( MPI_Initialized(&sflag) );
 
     if ( ! sflag) {
+#ifdef _OPENMP
+        //
+        // The master thread may call MPI while other threads compute, as
+        // Amr::timeStep does with amr.async_advance.
+        //
+        int provided;
+        BL_MPI_REQUIRE( MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &provided) );
+#else
 	BL_MPI_REQUIRE( MPI_Init(argc, argv) );
+#endif
         call_mpi_finalize = 1;
     }
     
@@ -43,7 +43,7 @@ MLABecLaplacian::define (const Vector<Geometry>& a_geom,
                 const BoxArray& ba = amrex::convert(m_grids[amrlev][mglev], IntVect::TheDimensionVector(idim));
                 m_b_coeffs[amrlev][mglev][idim].define(ba,
                                                        m_dmap[amrlev][mglev],
-                                                       1, 0);
+                                                       m_ncomp, 0);
             }
         }
     }
@@ -64,12 +64,19 @@ MLABecLaplacian::setScalars (Real a, Real b)
             m_a_coeffs[amrlev][0].setVal(0.0);
         }
     }
+    m_needs_update = true;
 }
 
+// The metric terms are applied here rather than in prepareForSolve so
+// that repeated solves with unchanged coefficients do not apply them again.
 void
 MLABecLaplacian::setACoeffs (int amrlev, const MultiFab& alpha)
 {
     MultiFab::Copy(m_a_coeffs[amrlev][0], alpha, 0, 0, 1, 0);
+#if (AMREX_SPACEDIM != 3)
+    applyMetricTerm(amrlev, 0, m_a_coeffs[amrlev][0]);
+#endif
+    m_needs_update = true;
 }
 
 void
@@ -77,8 +84,19 @@ MLABecLaplacian::setBCoeffs (int amrlev,
                              const std::array<MultiFab const*,AMREX_SPACEDIM>& beta)
 {
     for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-        MultiFab::Copy(m_b_coeffs[amrlev][0][idim], *beta[idim], 0, 0, 1, 0);
+        AMREX_ALWAYS_ASSERT(beta[idim]->nComp() == 1 || beta[idim]->nComp() == m_ncomp);
+        if (beta[idim]->nComp() == m_ncomp) {
+            MultiFab::Copy(m_b_coeffs[amrlev][0][idim], *beta[idim], 0, 0, m_ncomp, 0);
+        } else {
+            for (int n = 0; n < m_ncomp; ++n) {
+                MultiFab::Copy(m_b_coeffs[amrlev][0][idim], *beta[idim], 0, n, 1, 0);
+            }
+        }
+#if (AMREX_SPACEDIM != 3)
+        applyMetricTerm(amrlev, 0, m_b_coeffs[amrlev][0][idim]);
+#endif
     }
+    m_needs_update = true;
 }
 
 void
@@ -144,7 +162,7 @@ MLABecLaplacian::averageDownCoeffsToCoarseAmrLevel (int flev)
     for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
         BoxArray ba = fine_b_coeffs[idim].boxArray();
         ba.coarsen(mg_coarsen_ratio);
-        bb[idim].define(ba, fine_b_coeffs[idim].DistributionMap(), 1, 0);
+        bb[idim].define(ba, fine_b_coeffs[idim].DistributionMap(), m_ncomp, 0);
         crse[idim] = &bb[idim];
         fine[idim] = &fine_b_coeffs[idim];
     }
@@ -157,34 +175,43 @@ MLABecLaplacian::averageDownCoeffsToCoarseAmrLevel (int flev)
 }
 
 void
-MLABecLaplacian::applyMetricTermsCoeffs ()
+MLABecLaplacian::prepareForSolve ()
 {
-#if (AMREX_SPACEDIM != 3)
-    for (int alev = 0; alev < m_num_amr_levels; ++alev)
-    {
-        const int mglev = 0;
-        applyMetricTerm(alev, mglev, m_a_coeffs[alev][mglev]);
-        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
-        {
-            applyMetricTerm(alev, mglev, m_b_coeffs[alev][mglev][idim]);
-        }
-    }
-#endif
+    BL_PROFILE("MLABecLaplacian::prepareForSolve()");
+
+    MLCellLinOp::prepareForSolve();
+
+    averageDownCoeffs();
+
+    updateSingularFlag();
+
+    m_needs_update = false;
 }
 
 void
-MLABecLaplacian::prepareForSolve ()
+MLABecLaplacian::update ()
 {
-    BL_PROFILE("MLABecLaplacian::prepareForSolve()");
+    BL_PROFILE("MLABecLaplacian::update()");
 
-    MLCellLinOp::prepareForSolve();
+    const bool bc_changed = MLCellLinOp::needsUpdate();
+    if (bc_changed) {
+        MLCellLinOp::update();
+    }
 
-#if (AMREX_SPACEDIM != 3)
-    applyMetricTermsCoeffs();
-#endif
+    if (m_needs_update) {
+        averageDownCoeffs();
+    }
 
-    averageDownCoeffs();
+    if (m_needs_update || bc_changed) {
+        updateSingularFlag();
+    }
 
+    m_needs_update = false;
+}
+
+void
+MLABecLaplacian::updateSingularFlag ()
+{
     m_is_singular.clear();
     m_is_singular.resize(m_num_amr_levels, false);
     auto itlo = std::find(m_lobc.begin(), m_lobc.end(), BCType::Dirichlet);
@@ -235,14 +262,16 @@ MLABecLaplacian::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& i
                      const FArrayBox& byfab = bycoef[mfi];,
                      const FArrayBox& bzfab = bzcoef[mfi];);
 
-        amrex_mlabeclap_adotx(BL_TO_FORTRAN_BOX(bx),
-                              BL_TO_FORTRAN_ANYD(yfab),
-                              BL_TO_FORTRAN_ANYD(xfab),
-                              BL_TO_FORTRAN_ANYD(afab),
-                              AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bxfab),
-                                           BL_TO_FORTRAN_ANYD(byfab),
-                                           BL_TO_FORTRAN_ANYD(bzfab)),
-                              dxinv, m_a_scalar, m_b_scalar);
+        for (int n = 0; n < m_ncomp; ++n) {
+            amrex_mlabeclap_adotx(BL_TO_FORTRAN_BOX(bx),
+                                  BL_TO_FORTRAN_N_ANYD(yfab,n),
+                                  BL_TO_FORTRAN_N_ANYD(xfab,n),
+                                  BL_TO_FORTRAN_ANYD(afab),
+                                  AMREX_D_DECL(BL_TO_FORTRAN_N_ANYD(bxfab,n),
+                                               BL_TO_FORTRAN_N_ANYD(byfab,n),
+                                               BL_TO_FORTRAN_N_ANYD(bzfab,n)),
+                                  dxinv, m_a_scalar, m_b_scalar);
+        }
 
     }
 }
@@ -271,13 +300,15 @@ MLABecLaplacian::normalize (int amrlev, int mglev, MultiFab& mf) const
                      const FArrayBox& byfab = bycoef[mfi];,
                      const FArrayBox& bzfab = bzcoef[mfi];);
 
-        amrex_mlabeclap_normalize(BL_TO_FORTRAN_BOX(bx),
-                                  BL_TO_FORTRAN_ANYD(fab),
-                                  BL_TO_FORTRAN_ANYD(afab),
-                                  AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bxfab),
-                                               BL_TO_FORTRAN_ANYD(byfab),
-                                               BL_TO_FORTRAN_ANYD(bzfab)),
-                                  dxinv, m_a_scalar, m_b_scalar);
+        for (int n = 0; n < m_ncomp; ++n) {
+            amrex_mlabeclap_normalize(BL_TO_FORTRAN_BOX(bx),
+                                      BL_TO_FORTRAN_N_ANYD(fab,n),
+                                      BL_TO_FORTRAN_ANYD(afab),
+                                      AMREX_D_DECL(BL_TO_FORTRAN_N_ANYD(bxfab,n),
+                                                   BL_TO_FORTRAN_N_ANYD(byfab,n),
+                                                   BL_TO_FORTRAN_N_ANYD(bzfab,n)),
+                                      dxinv, m_a_scalar, m_b_scalar);
+        }
 
     }
 }
@@ -359,62 +390,206 @@ MLABecLaplacian::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab&
 #endif
 #endif
 
+        for (int n = 0; n < m_ncomp; ++n)
+        {
 #if (AMREX_SPACEDIM == 1)
-        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(tbx == vbx, "MLABecLaplacian::Fsmooth: 1d tiling not supported");
-        FORT_LINESOLVE (solnfab.dataPtr(), ARLIM(solnfab.loVect()),ARLIM(solnfab.hiVect()),
-                        rhsfab.dataPtr(), ARLIM(rhsfab.loVect()), ARLIM(rhsfab.hiVect()),
-                        &m_a_scalar, &m_b_scalar,
-                        afab.dataPtr(), ARLIM(afab.loVect()),    ARLIM(afab.hiVect()),
-                        bxfab.dataPtr(), ARLIM(bxfab.loVect()),   ARLIM(bxfab.hiVect()),
-                        f0fab.dataPtr(), ARLIM(f0fab.loVect()),   ARLIM(f0fab.hiVect()),
-                        m0.dataPtr(), ARLIM(m0.loVect()),   ARLIM(m0.hiVect()),
-                        f1fab.dataPtr(), ARLIM(f1fab.loVect()),   ARLIM(f1fab.hiVect()),
-                        m1.dataPtr(), ARLIM(m1.loVect()),   ARLIM(m1.hiVect()),
-                        tbx.loVect(), tbx.hiVect(), &nc, h);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(tbx == vbx, "MLABecLaplacian::Fsmooth: 1d tiling not supported");
+            FORT_LINESOLVE (solnfab.dataPtr(n), ARLIM(solnfab.loVect()),ARLIM(solnfab.hiVect()),
+                            rhsfab.dataPtr(n), ARLIM(rhsfab.loVect()), ARLIM(rhsfab.hiVect()),
+                            &m_a_scalar, &m_b_scalar,
+                            afab.dataPtr(), ARLIM(afab.loVect()),    ARLIM(afab.hiVect()),
+                            bxfab.dataPtr(n), ARLIM(bxfab.loVect()),   ARLIM(bxfab.hiVect()),
+                            f0fab.dataPtr(), ARLIM(f0fab.loVect()),   ARLIM(f0fab.hiVect()),
+                            m0.dataPtr(), ARLIM(m0.loVect()),   ARLIM(m0.hiVect()),
+                            f1fab.dataPtr(), ARLIM(f1fab.loVect()),   ARLIM(f1fab.hiVect()),
+                            m1.dataPtr(), ARLIM(m1.loVect()),   ARLIM(m1.hiVect()),
+                            tbx.loVect(), tbx.hiVect(), &nc, h);
 #endif
 
 #if (AMREX_SPACEDIM == 2)
-        FORT_GSRB(solnfab.dataPtr(), ARLIM(solnfab.loVect()),ARLIM(solnfab.hiVect()),
-                  rhsfab.dataPtr(), ARLIM(rhsfab.loVect()), ARLIM(rhsfab.hiVect()),
-                  &m_a_scalar, &m_b_scalar,
-                  afab.dataPtr(), ARLIM(afab.loVect()),    ARLIM(afab.hiVect()),
-                  bxfab.dataPtr(), ARLIM(bxfab.loVect()),   ARLIM(bxfab.hiVect()),
-                  byfab.dataPtr(), ARLIM(byfab.loVect()),   ARLIM(byfab.hiVect()),
-                  f0fab.dataPtr(), ARLIM(f0fab.loVect()),   ARLIM(f0fab.hiVect()),
-                  m0.dataPtr(), ARLIM(m0.loVect()),   ARLIM(m0.hiVect()),
-                  f1fab.dataPtr(), ARLIM(f1fab.loVect()),   ARLIM(f1fab.hiVect()),
-                  m1.dataPtr(), ARLIM(m1.loVect()),   ARLIM(m1.hiVect()),
-                  f2fab.dataPtr(), ARLIM(f2fab.loVect()),   ARLIM(f2fab.hiVect()),
-                  m2.dataPtr(), ARLIM(m2.loVect()),   ARLIM(m2.hiVect()),
-                  f3fab.dataPtr(), ARLIM(f3fab.loVect()),   ARLIM(f3fab.hiVect()),
-                  m3.dataPtr(), ARLIM(m3.loVect()),   ARLIM(m3.hiVect()),
-                  tbx.loVect(), tbx.hiVect(), vbx.loVect(), vbx.hiVect(),
-                  &nc, h, &redblack);
+            FORT_GSRB(solnfab.dataPtr(n), ARLIM(solnfab.loVect()),ARLIM(solnfab.hiVect()),
+                      rhsfab.dataPtr(n), ARLIM(rhsfab.loVect()), ARLIM(rhsfab.hiVect()),
+                      &m_a_scalar, &m_b_scalar,
+                      afab.dataPtr(), ARLIM(afab.loVect()),    ARLIM(afab.hiVect()),
+                      bxfab.dataPtr(n), ARLIM(bxfab.loVect()),   ARLIM(bxfab.hiVect()),
+                      byfab.dataPtr(n), ARLIM(byfab.loVect()),   ARLIM(byfab.hiVect()),
+                      f0fab.dataPtr(), ARLIM(f0fab.loVect()),   ARLIM(f0fab.hiVect()),
+                      m0.dataPtr(), ARLIM(m0.loVect()),   ARLIM(m0.hiVect()),
+                      f1fab.dataPtr(), ARLIM(f1fab.loVect()),   ARLIM(f1fab.hiVect()),
+                      m1.dataPtr(), ARLIM(m1.loVect()),   ARLIM(m1.hiVect()),
+                      f2fab.dataPtr(), ARLIM(f2fab.loVect()),   ARLIM(f2fab.hiVect()),
+                      m2.dataPtr(), ARLIM(m2.loVect()),   ARLIM(m2.hiVect()),
+                      f3fab.dataPtr(), ARLIM(f3fab.loVect()),   ARLIM(f3fab.hiVect()),
+                      m3.dataPtr(), ARLIM(m3.loVect()),   ARLIM(m3.hiVect()),
+                      tbx.loVect(), tbx.hiVect(), vbx.loVect(), vbx.hiVect(),
+                      &nc, h, &redblack);
 #endif
 
 #if (AMREX_SPACEDIM == 3)
-        FORT_GSRB(solnfab.dataPtr(), ARLIM(solnfab.loVect()),ARLIM(solnfab.hiVect()),
-                  rhsfab.dataPtr(), ARLIM(rhsfab.loVect()), ARLIM(rhsfab.hiVect()),
-                  &m_a_scalar, &m_b_scalar,
-                  afab.dataPtr(), ARLIM(afab.loVect()), ARLIM(afab.hiVect()),
-                  bxfab.dataPtr(), ARLIM(bxfab.loVect()), ARLIM(bxfab.hiVect()),
-                  byfab.dataPtr(), ARLIM(byfab.loVect()), ARLIM(byfab.hiVect()),
-                  bzfab.dataPtr(), ARLIM(bzfab.loVect()), ARLIM(bzfab.hiVect()),
-                  f0fab.dataPtr(), ARLIM(f0fab.loVect()), ARLIM(f0fab.hiVect()),
-                  m0.dataPtr(), ARLIM(m0.loVect()), ARLIM(m0.hiVect()),
-                  f1fab.dataPtr(), ARLIM(f1fab.loVect()), ARLIM(f1fab.hiVect()),
-                  m1.dataPtr(), ARLIM(m1.loVect()), ARLIM(m1.hiVect()),
-                  f2fab.dataPtr(), ARLIM(f2fab.loVect()), ARLIM(f2fab.hiVect()),
-                  m2.dataPtr(), ARLIM(m2.loVect()), ARLIM(m2.hiVect()),
-                  f3fab.dataPtr(), ARLIM(f3fab.loVect()), ARLIM(f3fab.hiVect()),
-                  m3.dataPtr(), ARLIM(m3.loVect()), ARLIM(m3.hiVect()),
-                  f4fab.dataPtr(), ARLIM(f4fab.loVect()), ARLIM(f4fab.hiVect()),
-                  m4.dataPtr(), ARLIM(m4.loVect()), ARLIM(m4.hiVect()),
-                  f5fab.dataPtr(), ARLIM(f5fab.loVect()), ARLIM(f5fab.hiVect()),
-                  m5.dataPtr(), ARLIM(m5.loVect()), ARLIM(m5.hiVect()),
-                  tbx.loVect(), tbx.hiVect(), vbx.loVect(), vbx.hiVect(),
-                  &nc, h, &redblack);
+            FORT_GSRB(solnfab.dataPtr(n), ARLIM(solnfab.loVect()),ARLIM(solnfab.hiVect()),
+                      rhsfab.dataPtr(n), ARLIM(rhsfab.loVect()), ARLIM(rhsfab.hiVect()),
+                      &m_a_scalar, &m_b_scalar,
+                      afab.dataPtr(), ARLIM(afab.loVect()), ARLIM(afab.hiVect()),
+                      bxfab.dataPtr(n), ARLIM(bxfab.loVect()), ARLIM(bxfab.hiVect()),
+                      byfab.dataPtr(n), ARLIM(byfab.loVect()), ARLIM(byfab.hiVect()),
+                      bzfab.dataPtr(n), ARLIM(bzfab.loVect()), ARLIM(bzfab.hiVect()),
+                      f0fab.dataPtr(), ARLIM(f0fab.loVect()), ARLIM(f0fab.hiVect()),
+                      m0.dataPtr(), ARLIM(m0.loVect()), ARLIM(m0.hiVect()),
+                      f1fab.dataPtr(), ARLIM(f1fab.loVect()), ARLIM(f1fab.hiVect()),
+                      m1.dataPtr(), ARLIM(m1.loVect()), ARLIM(m1.hiVect()),
+                      f2fab.dataPtr(), ARLIM(f2fab.loVect()), ARLIM(f2fab.hiVect()),
+                      m2.dataPtr(), ARLIM(m2.loVect()), ARLIM(m2.hiVect()),
+                      f3fab.dataPtr(), ARLIM(f3fab.loVect()), ARLIM(f3fab.hiVect()),
+                      m3.dataPtr(), ARLIM(m3.loVect()), ARLIM(m3.hiVect()),
+                      f4fab.dataPtr(), ARLIM(f4fab.loVect()), ARLIM(f4fab.hiVect()),
+                      m4.dataPtr(), ARLIM(m4.loVect()), ARLIM(m4.hiVect()),
+                      f5fab.dataPtr(), ARLIM(f5fab.loVect()), ARLIM(f5fab.hiVect()),
+                      m5.dataPtr(), ARLIM(m5.loVect()), ARLIM(m5.hiVect()),
+                      tbx.loVect(), tbx.hiVect(), vbx.loVect(), vbx.hiVect(),
+                      &nc, h, &redblack);
+#endif
+        }
+    }
+}
+
+void
+MLABecLaplacian::prepareForMixedPrecision ()
+{
+    BL_PROFILE("MLABecLaplacian::prepareForMixedPrecision()");
+
+    const int amrlev = 0;
+    const int nmglevs = m_num_mg_levels[amrlev];
+    m_a_coeffs_sp.resize(nmglevs);
+    m_b_coeffs_sp.resize(nmglevs);
+    for (int mglev = 0; mglev < nmglevs; ++mglev)
+    {
+        const MultiFab& a = m_a_coeffs[amrlev][mglev];
+        if (m_a_coeffs_sp[mglev].empty()) {
+            m_a_coeffs_sp[mglev].define(a.boxArray(), a.DistributionMap(), 1, a.nGrow());
+        }
+        copyToSP(m_a_coeffs_sp[mglev], a, 1.0, a.nGrow());
+
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+        {
+            const MultiFab& b = m_b_coeffs[amrlev][mglev][idim];
+            fMultiFab& bsp = m_b_coeffs_sp[mglev][idim];
+            if (bsp.empty()) {
+                bsp.define(b.boxArray(), b.DistributionMap(), 1, b.nGrow());
+            }
+            copyToSP(bsp, b, 1.0, b.nGrow());
+        }
+    }
+}
+
+void
+MLABecLaplacian::FapplySP (int amrlev, int mglev, fMultiFab& out, const fMultiFab& in) const
+{
+    BL_PROFILE("MLABecLaplacian::FapplySP()");
+
+    AMREX_ASSERT(amrlev == 0);
+
+    const fMultiFab& acoef = m_a_coeffs_sp[mglev];
+    AMREX_D_TERM(const fMultiFab& bxcoef = m_b_coeffs_sp[mglev][0];,
+                 const fMultiFab& bycoef = m_b_coeffs_sp[mglev][1];,
+                 const fMultiFab& bzcoef = m_b_coeffs_sp[mglev][2];);
+
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+
+#ifdef _OPENMP
+#pragma omp parallel
 #endif
+    for (MFIter mfi(out, true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        amrex_mlabeclap_adotx_sp(BL_TO_FORTRAN_BOX(bx),
+                                 BL_TO_FORTRAN_ANYD(out[mfi]),
+                                 BL_TO_FORTRAN_ANYD(in[mfi]),
+                                 BL_TO_FORTRAN_ANYD(acoef[mfi]),
+                                 AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bxcoef[mfi]),
+                                              BL_TO_FORTRAN_ANYD(bycoef[mfi]),
+                                              BL_TO_FORTRAN_ANYD(bzcoef[mfi])),
+                                 dxinv, m_a_scalar, m_b_scalar);
+    }
+}
+
+void
+MLABecLaplacian::FsmoothSP (int amrlev, int mglev, fMultiFab& sol, const fMultiFab& rhs, int redblack) const
+{
+    BL_PROFILE("MLABecLaplacian::FsmoothSP()");
+
+    AMREX_ASSERT(amrlev == 0);
+
+    const fMultiFab& acoef = m_a_coeffs_sp[mglev];
+    AMREX_D_TERM(const fMultiFab& bxcoef = m_b_coeffs_sp[mglev][0];,
+                 const fMultiFab& bycoef = m_b_coeffs_sp[mglev][1];,
+                 const fMultiFab& bzcoef = m_b_coeffs_sp[mglev][2];);
+    const auto& undrrelxr = m_undrrelxr[amrlev][mglev];
+    const auto& maskvals  = m_maskvals [amrlev][mglev];
+
+    OrientationIter oitr;
+
+    const FabSet& f0 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f1 = undrrelxr[oitr()]; ++oitr;
+#if (AMREX_SPACEDIM > 1)
+    const FabSet& f2 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f3 = undrrelxr[oitr()]; ++oitr;
+#if (AMREX_SPACEDIM > 2)
+    const FabSet& f4 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f5 = undrrelxr[oitr()]; ++oitr;
+#endif
+#endif
+
+    const MultiMask& mm0 = maskvals[0];
+    const MultiMask& mm1 = maskvals[1];
+#if (AMREX_SPACEDIM > 1)
+    const MultiMask& mm2 = maskvals[2];
+    const MultiMask& mm3 = maskvals[3];
+#if (AMREX_SPACEDIM > 2)
+    const MultiMask& mm4 = maskvals[4];
+    const MultiMask& mm5 = maskvals[5];
+#endif
+#endif
+
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(sol,MFItInfo().EnableTiling().SetDynamic(true));
+         mfi.isValid(); ++mfi)
+    {
+        const Box& tbx = mfi.tilebox();
+        const Box& vbx = mfi.validbox();
+
+        amrex_mlabeclap_gsrb_sp(BL_TO_FORTRAN_BOX(tbx),
+                                BL_TO_FORTRAN_ANYD(sol[mfi]),
+                                BL_TO_FORTRAN_ANYD(rhs[mfi]),
+                                BL_TO_FORTRAN_ANYD(acoef[mfi]),
+                                AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bxcoef[mfi]),
+                                             BL_TO_FORTRAN_ANYD(bycoef[mfi]),
+                                             BL_TO_FORTRAN_ANYD(bzcoef[mfi])),
+                                BL_TO_FORTRAN_ANYD(f0[mfi]),
+                                BL_TO_FORTRAN_ANYD(f1[mfi]),
+#if (AMREX_SPACEDIM > 1)
+                                BL_TO_FORTRAN_ANYD(f2[mfi]),
+                                BL_TO_FORTRAN_ANYD(f3[mfi]),
+#if (AMREX_SPACEDIM > 2)
+                                BL_TO_FORTRAN_ANYD(f4[mfi]),
+                                BL_TO_FORTRAN_ANYD(f5[mfi]),
+#endif
+#endif
+                                BL_TO_FORTRAN_ANYD(mm0[mfi]),
+                                BL_TO_FORTRAN_ANYD(mm1[mfi]),
+#if (AMREX_SPACEDIM > 1)
+                                BL_TO_FORTRAN_ANYD(mm2[mfi]),
+                                BL_TO_FORTRAN_ANYD(mm3[mfi]),
+#if (AMREX_SPACEDIM > 2)
+                                BL_TO_FORTRAN_ANYD(mm4[mfi]),
+                                BL_TO_FORTRAN_ANYD(mm5[mfi]),
+#endif
+#endif
+                                BL_TO_FORTRAN_BOX(vbx), dxinv,
+                                m_a_scalar, m_b_scalar, redblack);
     }
 }
 
@@ -432,15 +607,17 @@ MLABecLaplacian::FFlux (int amrlev, const MFIter& mfi,
     const Box& box = mfi.tilebox();
     const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
 
-    amrex_mlabeclap_flux(BL_TO_FORTRAN_BOX(box),
-                         AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*flux[0]),
-                                      BL_TO_FORTRAN_ANYD(*flux[1]),
-                                      BL_TO_FORTRAN_ANYD(*flux[2])),
-                         BL_TO_FORTRAN_ANYD(sol),
-                         AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bx),
-                                      BL_TO_FORTRAN_ANYD(by),
-                                      BL_TO_FORTRAN_ANYD(bz)),
-                         dxinv, m_b_scalar, face_only);
+    for (int n = 0; n < m_ncomp; ++n) {
+        amrex_mlabeclap_flux(BL_TO_FORTRAN_BOX(box),
+                             AMREX_D_DECL(BL_TO_FORTRAN_N_ANYD(*flux[0],n),
+                                          BL_TO_FORTRAN_N_ANYD(*flux[1],n),
+                                          BL_TO_FORTRAN_N_ANYD(*flux[2],n)),
+                             BL_TO_FORTRAN_N_ANYD(sol,n),
+                             AMREX_D_DECL(BL_TO_FORTRAN_N_ANYD(bx,n),
+                                          BL_TO_FORTRAN_N_ANYD(by,n),
+                                          BL_TO_FORTRAN_N_ANYD(bz,n)),
+                             dxinv, m_b_scalar, face_only);
+    }
 }
 
 }
@@ -55,12 +55,14 @@ MLALaplacian::setScalars (Real a, Real b)
             m_a_coeffs[amrlev][0].setVal(0.0);
         }
     }
+    m_needs_update = true;
 }
 
 void
 MLALaplacian::setACoeffs (int amrlev, const MultiFab& alpha)
 {
     MultiFab::Copy(m_a_coeffs[amrlev][0], alpha, 0, 0, 1, 0);
+    m_needs_update = true;
 }
 
 void
@@ -116,6 +118,35 @@ MLALaplacian::prepareForSolve ()
 
     averageDownCoeffs();
 
+    updateSingularFlag();
+
+    m_needs_update = false;
+}
+
+void
+MLALaplacian::update ()
+{
+    BL_PROFILE("MLALaplacian::update()");
+
+    const bool bc_changed = MLCellLinOp::needsUpdate();
+    if (bc_changed) {
+        MLCellLinOp::update();
+    }
+
+    if (m_needs_update) {
+        averageDownCoeffs();
+    }
+
+    if (m_needs_update || bc_changed) {
+        updateSingularFlag();
+    }
+
+    m_needs_update = false;
+}
+
+void
+MLALaplacian::updateSingularFlag ()
+{
     m_is_singular.clear();
     m_is_singular.resize(m_num_amr_levels, false);
     auto itlo = std::find(m_lobc.begin(), m_lobc.end(), BCType::Dirichlet);
@@ -30,7 +30,7 @@ sxay (MultiFab&       ss,
 {
     BL_PROFILE("CGSolver::sxay()");
 
-    const int ncomp  = 1;
+    const int ncomp  = ss.nComp();
     const int sscomp = 0;
     const int xxcomp = 0;
     MultiFab::LinComb(ss, 1.0, xx, xxcomp, a, yy, yycomp, sscomp, ncomp, 0);
@@ -67,7 +67,7 @@ MLCGSolver::solve (MultiFab&       sol,
 {
     BL_PROFILE_REGION("MLCGSolver::solve()");
 
-    const int nghost = sol.nGrow(), ncomp = 1;
+    const int nghost = sol.nGrow(), ncomp = Lp.getNComp();
 
     const BoxArray& ba = sol.boxArray();
     const DistributionMapping& dm = sol.DistributionMap();
@@ -90,8 +90,8 @@ MLCGSolver::solve (MultiFab&       sol,
     Lp.correctionResidual(amrlev, mglev, r, sol, rhs, MLLinOp::BCMode::Homogeneous);
     Lp.normalize(amrlev, mglev, r);
 
-    MultiFab::Copy(sorig,sol,0,0,1,0);
-    MultiFab::Copy(rh,   r,  0,0,1,0);
+    MultiFab::Copy(sorig,sol,0,0,ncomp,0);
+    MultiFab::Copy(rh,   r,  0,0,ncomp,0);
 
     sol.setVal(0);
 
@@ -103,6 +103,7 @@ MLCGSolver::solve (MultiFab&       sol,
         std::cout << "MLCGSolver_BiCGStab: Initial error (error0) =        " << rnorm0 << '\n';
     }
     int ret = 0, nit = 1;
+    iter = 0;
     Real rho_1 = 0, alpha = 0, omega = 0;
 
     if ( rnorm0 == 0 || rnorm0 < eps_abs )
@@ -125,7 +126,7 @@ MLCGSolver::solve (MultiFab&       sol,
 	}
         if ( nit == 1 )
         {
-            MultiFab::Copy(p,r,0,0,1,0);
+            MultiFab::Copy(p,r,0,0,ncomp,0);
         }
         else
         {
@@ -133,7 +134,7 @@ MLCGSolver::solve (MultiFab&       sol,
             sxay(p, p, -omega, v);
             sxay(p, r,   beta, p);
         }
-        MultiFab::Copy(ph,p,0,0,1,0);
+        MultiFab::Copy(ph,p,0,0,ncomp,0);
         Lp.apply(amrlev, mglev, v, ph, MLLinOp::BCMode::Homogeneous);
         Lp.normalize(amrlev, mglev, v);
 
@@ -160,7 +161,7 @@ MLCGSolver::solve (MultiFab&       sol,
 
         if ( rnorm < eps_rel*rnorm0 || rnorm < eps_abs ) break;
 
-        MultiFab::Copy(sh,s,0,0,1,0);
+        MultiFab::Copy(sh,s,0,0,ncomp,0);
         Lp.apply(amrlev, mglev, t, sh, MLLinOp::BCMode::Homogeneous);
         Lp.normalize(amrlev, mglev, t);
         //
@@ -202,6 +203,8 @@ MLCGSolver::solve (MultiFab&       sol,
         rho_1 = rho;
     }
 
+    iter = std::min(nit, maxiter);
+
     if ( verbose > 0 && ParallelDescriptor::IOProcessor(p.color()) )
     {
         std::cout << "MLCGSolver_BiCGStab: Final: Iteration "
@@ -219,12 +222,12 @@ MLCGSolver::solve (MultiFab&       sol,
 
     if ( ( ret == 0 || ret == 8 ) && (rnorm < rnorm0) )
     {
-        sol.plus(sorig, 0, 1, 0);
+        sol.plus(sorig, 0, ncomp, 0);
     } 
     else 
     {
         sol.setVal(0);
-        sol.plus(sorig, 0, 1, 0);
+        sol.plus(sorig, 0, ncomp, 0);
     }
 
     return ret;
@@ -239,7 +242,10 @@ MLCGSolver::dotxy (const MultiFab& r, const MultiFab& z, bool local)
 Real
 MLCGSolver::norm_inf (const MultiFab& res, bool local)
 {
-    Real result = res.norm0(0,0,true);
+    Real result = 0.0;
+    for (int n = 0; n < res.nComp(); ++n) {
+        result = std::max(result, res.norm0(n,0,true));
+    }
     if (!local) {
         ParallelAllReduce::Max(result, Lp.BottomCommunicator());
     }
@@ -31,6 +31,10 @@ MLCellLinOp::defineAuxData ()
     m_undrrelxr.resize(m_num_amr_levels);
     m_maskvals.resize(m_num_amr_levels);
     m_fluxreg.resize(m_num_amr_levels-1);
+    m_levelbc_state.clear();
+    m_levelbc_state.resize(m_num_amr_levels);
+    m_interp_coef_stale.clear();
+    m_interp_coef_stale.resize(m_num_amr_levels, true);
 
     for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
     {
@@ -66,7 +70,7 @@ MLCellLinOp::defineAuxData ()
         m_fluxreg[amrlev].define(m_grids[amrlev+1][0], m_grids[amrlev][0],
                                  m_dmap[amrlev+1][0], m_dmap[amrlev][0],
                                  m_geom[amrlev+1][0], m_geom[amrlev][0],
-                                 ratio, amrlev+1, 1);
+                                 ratio, amrlev+1, getNComp());
     }
 
 #if (AMREX_SPACEDIM != 3)
@@ -89,6 +93,8 @@ MLCellLinOp::defineAuxData ()
 void
 MLCellLinOp::defineBC ()
 {
+    const int ncomp = getNComp();
+
     m_bndry_sol.resize(m_num_amr_levels);
     m_crse_sol_br.resize(m_num_amr_levels);
 
@@ -98,12 +104,11 @@ MLCellLinOp::defineBC ()
     for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
     {
         m_bndry_sol[amrlev].reset(new MLMGBndry(m_grids[amrlev][0], m_dmap[amrlev][0],
-                                                1, m_geom[amrlev][0]));
+                                                ncomp, m_geom[amrlev][0]));
     }
 
     for (int amrlev = 1; amrlev < m_num_amr_levels; ++amrlev)
     {
-        const int ncomp = 1;
         const int in_rad = 0;
         const int out_rad = 1;
         const int extent_rad = 2;
@@ -116,7 +121,6 @@ MLCellLinOp::defineBC ()
 
     for (int amrlev = 1; amrlev < m_num_amr_levels; ++amrlev)
     {
-        const int ncomp = 1;
         const int in_rad = 0;
         const int out_rad = 1;
         const int extent_rad = 2;
@@ -132,10 +136,10 @@ MLCellLinOp::defineBC ()
     for (int amrlev = 1; amrlev < m_num_amr_levels; ++amrlev)
     {
         m_bndry_cor[amrlev].reset(new MLMGBndry(m_grids[amrlev][0], m_dmap[amrlev][0],
-                                                1, m_geom[amrlev][0]));
-        MultiFab bc_data(m_grids[amrlev][0], m_dmap[amrlev][0], 1, 1);
+                                                ncomp, m_geom[amrlev][0]));
+        MultiFab bc_data(m_grids[amrlev][0], m_dmap[amrlev][0], ncomp, 1);
         bc_data.setVal(0.0);
-        m_bndry_cor[amrlev]->setBndryValues(*m_crse_cor_br[amrlev], 0, bc_data, 0, 0, 1,
+        m_bndry_cor[amrlev]->setBndryValues(*m_crse_cor_br[amrlev], 0, bc_data, 0, 0, ncomp,
                                             m_amr_ref_ratio[amrlev-1], BCRec());
         m_bndry_cor[amrlev]->setLOBndryConds({AMREX_D_DECL(BCType::Dirichlet,
                                                            BCType::Dirichlet,
@@ -165,12 +169,15 @@ MLCellLinOp::setLevelBC (int amrlev, const MultiFab* a_levelbcdata)
 
     AMREX_ALWAYS_ASSERT(amrlev >= 0 && amrlev < m_num_amr_levels);
 
+    const int ncomp = getNComp();
+
     MultiFab zero;
     if (a_levelbcdata == nullptr) {
-        zero.define(m_grids[amrlev][0], m_dmap[amrlev][0], 1, 1);
+        zero.define(m_grids[amrlev][0], m_dmap[amrlev][0], ncomp, 1);
         zero.setVal(0.0);
     } else {
         AMREX_ALWAYS_ASSERT(a_levelbcdata->nGrow() >= 1);
+        AMREX_ALWAYS_ASSERT(a_levelbcdata->nComp() >= ncomp);
     }
     const MultiFab& bcdata = (a_levelbcdata == nullptr) ? zero : *a_levelbcdata;
 
@@ -183,7 +190,6 @@ MLCellLinOp::setLevelBC (int amrlev, const MultiFab* a_levelbcdata)
             br_ref_ratio = m_coarse_data_crse_ratio > 0 ? m_coarse_data_crse_ratio : 2;
             if (m_crse_sol_br[amrlev] == nullptr && br_ref_ratio > 0)
             {
-                const int ncomp = 1;
                 const int in_rad = 0;
                 const int out_rad = 1;
                 const int extent_rad = 2;
@@ -197,25 +203,25 @@ MLCellLinOp::setLevelBC (int amrlev, const MultiFab* a_levelbcdata)
             if (m_coarse_data_for_bc != nullptr) {
                 AMREX_ALWAYS_ASSERT(m_coarse_data_crse_ratio > 0);
                 const Box& cbx = amrex::coarsen(m_geom[0][0].Domain(), m_coarse_data_crse_ratio);
-                m_crse_sol_br[amrlev]->copyFrom(*m_coarse_data_for_bc, 0, 0, 0, 1,
+                m_crse_sol_br[amrlev]->copyFrom(*m_coarse_data_for_bc, 0, 0, 0, ncomp,
                                                 Geometry::periodicity(cbx));
             } else {
                 m_crse_sol_br[amrlev]->setVal(0.0);
             }
             m_bndry_sol[amrlev]->setBndryValues(*m_crse_sol_br[amrlev], 0,
-                                                bcdata, 0, 0, 1,
+                                                bcdata, 0, 0, ncomp,
                                                 br_ref_ratio, BCRec());
             br_ref_ratio = m_coarse_data_crse_ratio;
         }
         else
         {
-            m_bndry_sol[amrlev]->setBndryValues(bcdata,0,0,1,BCRec());
+            m_bndry_sol[amrlev]->setBndryValues(bcdata,0,0,ncomp,BCRec());
             br_ref_ratio = 1;
         }
     }
     else
     {
-        m_bndry_sol[amrlev]->setBndryValues(bcdata,0,0,1, m_amr_ref_ratio[amrlev-1], BCRec());
+        m_bndry_sol[amrlev]->setBndryValues(bcdata,0,0,ncomp, m_amr_ref_ratio[amrlev-1], BCRec());
         br_ref_ratio = m_amr_ref_ratio[amrlev-1];
     }
 
@@ -228,6 +234,20 @@ MLCellLinOp::setLevelBC (int amrlev, const MultiFab* a_levelbcdata)
                                                    m_lobc, m_hibc,
                                                    br_ref_ratio, m_coarse_bc_loc);
     }
+
+    LevelBCState& state = m_levelbc_state[amrlev];
+    if (!state.built || state.lobc != m_lobc || state.hibc != m_hibc
+        || state.ref_ratio != br_ref_ratio || state.loc != m_coarse_bc_loc
+        || state.maxorder != maxorder)
+    {
+        state.lobc = m_lobc;
+        state.hibc = m_hibc;
+        state.ref_ratio = br_ref_ratio;
+        state.loc = m_coarse_bc_loc;
+        state.maxorder = maxorder;
+        state.built = true;
+        m_interp_coef_stale[amrlev] = true;
+    }
 }
 
 BoxArray
@@ -282,7 +302,7 @@ MLCellLinOp::makeNGrids (int grid_size) const
 void
 MLCellLinOp::restriction (int, int, MultiFab& crse, MultiFab& fine) const
 {
-    amrex::average_down(fine, crse, 0, 1, 2);
+    amrex::average_down(fine, crse, 0, getNComp(), 2);
 }
 
 void
@@ -294,7 +314,7 @@ MLCellLinOp::interpolation (int amrlev, int fmglev, MultiFab& fine, const MultiF
     for (MFIter mfi(crse,true); mfi.isValid(); ++mfi)
     {
         const Box&         bx = mfi.tilebox();
-        const int          nc = 1;
+        const int          nc = getNComp();
         const FArrayBox& cfab = crse[mfi];
         FArrayBox&       ffab = fine[mfi];
 
@@ -311,8 +331,9 @@ MLCellLinOp::averageDownSolutionRHS (int camrlev, MultiFab& crse_sol, MultiFab&
                                      const MultiFab& fine_sol, const MultiFab& fine_rhs)
 {
     const auto amrrr = AMRRefRatio(camrlev);
-    amrex::average_down(fine_sol, crse_sol, 0, 1, amrrr);
-    amrex::average_down(fine_rhs, crse_rhs, 0, 1, amrrr);
+    const int ncomp = getNComp();
+    amrex::average_down(fine_sol, crse_sol, 0, ncomp, amrrr);
+    amrex::average_down(fine_rhs, crse_rhs, 0, ncomp, amrrr);
 }
 
 void
@@ -329,6 +350,10 @@ MLCellLinOp::smooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
                      bool skip_fillboundary) const
 {
     BL_PROFILE("MLCellLinOp::smooth()");
+    if (useChebyshevSmoother()) {
+        chebyshevSmooth(amrlev, mglev, sol, rhs);
+        return;
+    }
     for (int redblack = 0; redblack < 2; ++redblack)
     {
         applyBC(amrlev, mglev, sol, BCMode::Homogeneous, nullptr, skip_fillboundary);
@@ -343,8 +368,9 @@ MLCellLinOp::updateSolBC (int amrlev, const MultiFab& crse_bcdata) const
     BL_PROFILE("MLCellLinOp::updateSolBC()");
 
     AMREX_ALWAYS_ASSERT(amrlev > 0);
-    m_crse_sol_br[amrlev]->copyFrom(crse_bcdata, 0, 0, 0, 1, m_geom[amrlev-1][0].periodicity());
-    m_bndry_sol[amrlev]->updateBndryValues(*m_crse_sol_br[amrlev], 0, 0, 1, m_amr_ref_ratio[amrlev-1]);
+    const int ncomp = getNComp();
+    m_crse_sol_br[amrlev]->copyFrom(crse_bcdata, 0, 0, 0, ncomp, m_geom[amrlev-1][0].periodicity());
+    m_bndry_sol[amrlev]->updateBndryValues(*m_crse_sol_br[amrlev], 0, 0, ncomp, m_amr_ref_ratio[amrlev-1]);
 }
 
 void
@@ -352,8 +378,9 @@ MLCellLinOp::updateCorBC (int amrlev, const MultiFab& crse_bcdata) const
 {
     BL_PROFILE("MLCellLinOp::updateCorBC()");
     AMREX_ALWAYS_ASSERT(amrlev > 0);
-    m_crse_cor_br[amrlev]->copyFrom(crse_bcdata, 0, 0, 0, 1, m_geom[amrlev-1][0].periodicity());
-    m_bndry_cor[amrlev]->updateBndryValues(*m_crse_cor_br[amrlev], 0, 0, 1, m_amr_ref_ratio[amrlev-1]);
+    const int ncomp = getNComp();
+    m_crse_cor_br[amrlev]->copyFrom(crse_bcdata, 0, 0, 0, ncomp, m_geom[amrlev-1][0].periodicity());
+    m_bndry_cor[amrlev]->updateBndryValues(*m_crse_cor_br[amrlev], 0, 0, ncomp, m_amr_ref_ratio[amrlev-1]);
 }
 
 void
@@ -413,9 +440,12 @@ MLCellLinOp::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode,
     BL_ASSERT(mglev == 0 || bc_mode == BCMode::Homogeneous);
     BL_ASSERT(bndry != nullptr || bc_mode == BCMode::Homogeneous);
 
+    const int ncomp = getNComp();
     const bool cross = true;
     if (!skip_fillboundary) {
-        in.FillBoundary(0, 1, m_geom[amrlev][mglev].periodicity(), cross);
+        const Real comm_start_time = amrex::second();
+        in.FillBoundary(0, ncomp, m_geom[amrlev][mglev].periodicity(), cross);
+        m_comm_time += amrex::second() - comm_start_time;
     }
 
     int flagbc = (bc_mode == BCMode::Homogeneous) ? 0 : 1;
@@ -451,16 +481,151 @@ MLCellLinOp::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode,
 
             const Mask& m = maskvals[ori][mfi];
 
-            amrex_mllinop_apply_bc(BL_TO_FORTRAN_BOX(vbx),
-                                   BL_TO_FORTRAN_ANYD(iofab),
-                                   BL_TO_FORTRAN_ANYD(m),
-                                   cdr, bct, bcl,
-                                   BL_TO_FORTRAN_ANYD(fsfab),
-                                   maxorder, dxinv, flagbc);
+            for (int icomp = 0; icomp < ncomp; ++icomp) {
+                const int fscomp = (bndry != nullptr) ? icomp : 0;
+                amrex_mllinop_apply_bc(BL_TO_FORTRAN_BOX(vbx),
+                                       BL_TO_FORTRAN_N_ANYD(iofab,icomp),
+                                       BL_TO_FORTRAN_ANYD(m),
+                                       cdr, bct, bcl,
+                                       BL_TO_FORTRAN_N_ANYD(fsfab,fscomp),
+                                       maxorder, dxinv, flagbc);
+            }
         }
     }
 }
 
+void
+MLCellLinOp::applyBCSP (int amrlev, int mglev, fMultiFab& in, bool skip_fillboundary) const
+{
+    BL_PROFILE("MLCellLinOp::applyBCSP()");
+
+    const bool cross = true;
+    if (!skip_fillboundary) {
+        const Real comm_start_time = amrex::second();
+        in.FillBoundary(0, 1, m_geom[amrlev][mglev].periodicity(), cross);
+        m_comm_time += amrex::second() - comm_start_time;
+    }
+
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+
+    const auto& maskvals = m_maskvals[amrlev][mglev];
+
+    const auto& bcondloc = *m_bcondloc[amrlev][mglev];
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(in, MFItInfo().SetDynamic(true)); mfi.isValid(); ++mfi)
+    {
+        const Box& vbx = mfi.validbox();
+        BaseFab<float>& iofab = in[mfi];
+
+        const RealTuple & bdl = bcondloc.bndryLocs(mfi);
+        const BCTuple   & bdc = bcondloc.bndryConds(mfi);
+
+        for (OrientationIter oitr; oitr; ++oitr)
+        {
+            const Orientation ori = oitr();
+
+            int  cdr = ori;
+            Real bcl = bdl[ori];
+            int  bct = bdc[ori];
+
+            const Mask& m = maskvals[ori][mfi];
+
+            amrex_mllinop_apply_bc_sp(BL_TO_FORTRAN_BOX(vbx),
+                                      BL_TO_FORTRAN_ANYD(iofab),
+                                      BL_TO_FORTRAN_ANYD(m),
+                                      cdr, bct, bcl, maxorder, dxinv);
+        }
+    }
+}
+
+void
+MLCellLinOp::restrictionSP (int, int, fMultiFab& crse, fMultiFab& fine) const
+{
+    BL_PROFILE("MLCellLinOp::restrictionSP()");
+
+    BoxArray cba = fine.boxArray();
+    cba.coarsen(mg_coarsen_ratio);
+
+    // Coarse MG grids are not necessarily coarsened fine grids
+    // because of agglomeration.
+    const bool direct = (cba == crse.boxArray() and fine.DistributionMap() == crse.DistributionMap());
+
+    fMultiFab ctmp;
+    if (!direct) {
+        ctmp.define(cba, fine.DistributionMap(), 1, 0);
+    }
+    fMultiFab& cmf = direct ? crse : ctmp;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(cmf,true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        amrex_mllinop_avgdown_sp(BL_TO_FORTRAN_BOX(bx),
+                                 BL_TO_FORTRAN_ANYD(cmf[mfi]),
+                                 BL_TO_FORTRAN_ANYD(fine[mfi]));
+    }
+
+    if (!direct) {
+        const Real comm_start_time = amrex::second();
+        crse.ParallelCopy(ctmp);
+        m_comm_time += amrex::second() - comm_start_time;
+    }
+}
+
+void
+MLCellLinOp::interpolationSP (int, int, fMultiFab& fine, const fMultiFab& crse) const
+{
+    BL_PROFILE("MLCellLinOp::interpolationSP()");
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(crse,true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        amrex_mllinop_interp_sp(BL_TO_FORTRAN_BOX(bx),
+                                BL_TO_FORTRAN_ANYD(fine[mfi]),
+                                BL_TO_FORTRAN_ANYD(crse[mfi]));
+    }
+}
+
+void
+MLCellLinOp::smoothSP (int amrlev, int mglev, fMultiFab& sol, const fMultiFab& rhs,
+                       bool skip_fillboundary) const
+{
+    BL_PROFILE("MLCellLinOp::smoothSP()");
+    for (int redblack = 0; redblack < 2; ++redblack)
+    {
+        applyBCSP(amrlev, mglev, sol, skip_fillboundary);
+        FsmoothSP(amrlev, mglev, sol, rhs, redblack);
+        skip_fillboundary = false;
+    }
+}
+
+void
+MLCellLinOp::correctionResidualSP (int amrlev, int mglev, fMultiFab& resid, fMultiFab& x,
+                                   const fMultiFab& b) const
+{
+    BL_PROFILE("MLCellLinOp::correctionResidualSP()");
+
+    applyBCSP(amrlev, mglev, x);
+    FapplySP(amrlev, mglev, resid, x);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(resid,true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        resid[mfi].mult(-1.0f, bx);
+        resid[mfi].plus(b[mfi], bx, 0, 0, 1);
+    }
+}
+
 void
 MLCellLinOp::reflux (int crse_amrlev,
                      MultiFab& res, const MultiFab& crse_sol, const MultiFab&,
@@ -477,6 +642,7 @@ MLCellLinOp::reflux (int crse_amrlev,
     const Real* fine_dx = m_geom[fine_amrlev][0].CellSize();
 
     const int mglev = 0;
+    const int ncomp = getNComp();
     applyBC(fine_amrlev, mglev, fine_sol, BCMode::Inhomogeneous, m_bndry_sol[fine_amrlev].get());
 
 #ifdef _OPENMP
@@ -492,9 +658,9 @@ MLCellLinOp::reflux (int crse_amrlev,
             if (fluxreg.CrseHasWork(mfi))
             {
                 const Box& tbx = mfi.tilebox();
-                AMREX_D_TERM(flux[0].resize(amrex::surroundingNodes(tbx,0));,
-                             flux[1].resize(amrex::surroundingNodes(tbx,1));,
-                             flux[2].resize(amrex::surroundingNodes(tbx,2)););
+                AMREX_D_TERM(flux[0].resize(amrex::surroundingNodes(tbx,0),ncomp);,
+                             flux[1].resize(amrex::surroundingNodes(tbx,1),ncomp);,
+                             flux[2].resize(amrex::surroundingNodes(tbx,2),ncomp););
                 FFlux(crse_amrlev, mfi, pflux, crse_sol[mfi]);
                 fluxreg.CrseAdd(mfi, cpflux, crse_dx, dt);
             }
@@ -509,9 +675,9 @@ MLCellLinOp::reflux (int crse_amrlev,
             if (fluxreg.FineHasWork(mfi))
             {
                 const Box& tbx = mfi.tilebox();
-                AMREX_D_TERM(flux[0].resize(amrex::surroundingNodes(tbx,0));,
-                             flux[1].resize(amrex::surroundingNodes(tbx,1));,
-                             flux[2].resize(amrex::surroundingNodes(tbx,2)););
+                AMREX_D_TERM(flux[0].resize(amrex::surroundingNodes(tbx,0),ncomp);,
+                             flux[1].resize(amrex::surroundingNodes(tbx,1),ncomp);,
+                             flux[2].resize(amrex::surroundingNodes(tbx,2),ncomp););
                 const int face_only = true;
                 FFlux(fine_amrlev, mfi, pflux, fine_sol[mfi], face_only);
                 fluxreg.FineAdd(mfi, cpflux, fine_dx, dt);            
@@ -528,6 +694,7 @@ MLCellLinOp::compFlux (int amrlev, const std::array<MultiFab*,AMREX_SPACEDIM>& f
     BL_PROFILE("MLCellLinOp::compFlux()");
 
     const int mglev = 0;
+    const int ncomp = getNComp();
     applyBC(amrlev, mglev, sol, BCMode::Inhomogeneous, m_bndry_sol[amrlev].get());
 
 #ifdef _OPENMP
@@ -539,13 +706,13 @@ MLCellLinOp::compFlux (int amrlev, const std::array<MultiFab*,AMREX_SPACEDIM>& f
         for (MFIter mfi(sol, MFItInfo().EnableTiling().SetDynamic(true));  mfi.isValid(); ++mfi)
         {
             const Box& tbx = mfi.tilebox();
-            AMREX_D_TERM(flux[0].resize(amrex::surroundingNodes(tbx,0));,
-                         flux[1].resize(amrex::surroundingNodes(tbx,1));,
-                         flux[2].resize(amrex::surroundingNodes(tbx,2)););
+            AMREX_D_TERM(flux[0].resize(amrex::surroundingNodes(tbx,0),ncomp);,
+                         flux[1].resize(amrex::surroundingNodes(tbx,1),ncomp);,
+                         flux[2].resize(amrex::surroundingNodes(tbx,2),ncomp););
             FFlux(amrlev, mfi, pflux, sol[mfi]);
             for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
                 const Box& nbx = mfi.nodaltilebox(idim);
-                (*fluxes[idim])[mfi].copy(flux[idim], nbx, 0, nbx, 0, 1);
+                (*fluxes[idim])[mfi].copy(flux[idim], nbx, 0, nbx, 0, ncomp);
             }
         }
     }
@@ -560,6 +727,7 @@ MLCellLinOp::compGrad (int amrlev, const std::array<MultiFab*,AMREX_SPACEDIM>& g
     applyBC(amrlev, mglev, sol, BCMode::Inhomogeneous, m_bndry_sol[amrlev].get());
 
     const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+    const int ncomp = getNComp();
 
 #ifdef _OPENMP
 #pragma omp parallel
@@ -569,14 +737,16 @@ MLCellLinOp::compGrad (int amrlev, const std::array<MultiFab*,AMREX_SPACEDIM>& g
         AMREX_D_TERM(const Box& xbx = mfi.nodaltilebox(0);,
                      const Box& ybx = mfi.nodaltilebox(1);,
                      const Box& zbx = mfi.nodaltilebox(2););
-        amrex_mllinop_grad(AMREX_D_DECL(BL_TO_FORTRAN_BOX(xbx),
-                                        BL_TO_FORTRAN_BOX(ybx),
-                                        BL_TO_FORTRAN_BOX(zbx)),
-                           BL_TO_FORTRAN_ANYD(sol[mfi]),
-                           AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*grad[0])[mfi]),
-                                        BL_TO_FORTRAN_ANYD((*grad[1])[mfi]),
-                                        BL_TO_FORTRAN_ANYD((*grad[2])[mfi])),
-                           dxinv);
+        for (int icomp = 0; icomp < ncomp; ++icomp) {
+            amrex_mllinop_grad(AMREX_D_DECL(BL_TO_FORTRAN_BOX(xbx),
+                                            BL_TO_FORTRAN_BOX(ybx),
+                                            BL_TO_FORTRAN_BOX(zbx)),
+                               BL_TO_FORTRAN_N_ANYD(sol[mfi],icomp),
+                               AMREX_D_DECL(BL_TO_FORTRAN_N_ANYD((*grad[0])[mfi],icomp),
+                                            BL_TO_FORTRAN_N_ANYD((*grad[1])[mfi],icomp),
+                                            BL_TO_FORTRAN_N_ANYD((*grad[2])[mfi],icomp)),
+                               dxinv);
+        }
     }
 }
 
@@ -587,49 +757,79 @@ MLCellLinOp::prepareForSolve ()
 
     for (int amrlev = 0;  amrlev < m_num_amr_levels; ++amrlev)
     {
-        for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
-        {
-            const auto& bcondloc = *m_bcondloc[amrlev][mglev];
-            const auto& maskvals = m_maskvals[amrlev][mglev];
-            const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+        computeInterpCoefs(amrlev);
+    }
+}
+
+bool
+MLCellLinOp::needsUpdate () const
+{
+    return std::find(m_interp_coef_stale.begin(), m_interp_coef_stale.end(), 1)
+        != m_interp_coef_stale.end();
+}
+
+void
+MLCellLinOp::update ()
+{
+    BL_PROFILE("MLCellLinOp::update()");
+
+    for (int amrlev = 0;  amrlev < m_num_amr_levels; ++amrlev)
+    {
+        if (m_interp_coef_stale[amrlev]) {
+            computeInterpCoefs(amrlev);
+        }
+    }
+}
+
+void
+MLCellLinOp::computeInterpCoefs (int amrlev)
+{
+    BL_PROFILE("MLCellLinOp::computeInterpCoefs()");
 
-            BndryRegister& undrrelxr = m_undrrelxr[amrlev][mglev];
-            MultiFab foo(m_grids[amrlev][mglev], m_dmap[amrlev][mglev], 1, 0, MFInfo().SetAlloc(false));
+    for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
+    {
+        const auto& bcondloc = *m_bcondloc[amrlev][mglev];
+        const auto& maskvals = m_maskvals[amrlev][mglev];
+        const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+
+        BndryRegister& undrrelxr = m_undrrelxr[amrlev][mglev];
+        MultiFab foo(m_grids[amrlev][mglev], m_dmap[amrlev][mglev], 1, 0, MFInfo().SetAlloc(false));
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-            for (MFIter mfi(foo, MFItInfo().SetDynamic(true)); mfi.isValid(); ++mfi)
+        for (MFIter mfi(foo, MFItInfo().SetDynamic(true)); mfi.isValid(); ++mfi)
+        {
+            const Box& vbx = mfi.validbox();
+
+            const RealTuple & bdl = bcondloc.bndryLocs(mfi);
+            const BCTuple   & bdc = bcondloc.bndryConds(mfi);
+
+            for (OrientationIter oitr; oitr; ++oitr)
             {
-                const Box& vbx = mfi.validbox();
+                const Orientation ori = oitr();
 
-                const RealTuple & bdl = bcondloc.bndryLocs(mfi);
-                const BCTuple   & bdc = bcondloc.bndryConds(mfi);
+                int  cdr = ori;
+                Real bcl = bdl[ori];
+                int  bct = bdc[ori];
 
-                for (OrientationIter oitr; oitr; ++oitr)
-                {
-                    const Orientation ori = oitr();
-                    
-                    int  cdr = ori;
-                    Real bcl = bdl[ori];
-                    int  bct = bdc[ori];
-                    
-                    FArrayBox& ffab = undrrelxr[ori][mfi];
-                    const Mask& m   =  maskvals[ori][mfi];
-
-                    amrex_mllinop_comp_interp_coef0(BL_TO_FORTRAN_BOX(vbx),
-                                                    BL_TO_FORTRAN_ANYD(ffab),
-                                                    BL_TO_FORTRAN_ANYD(m),
-                                                    cdr, bct, bcl, maxorder, dxinv);
-                }
+                FArrayBox& ffab = undrrelxr[ori][mfi];
+                const Mask& m   =  maskvals[ori][mfi];
+
+                amrex_mllinop_comp_interp_coef0(BL_TO_FORTRAN_BOX(vbx),
+                                                BL_TO_FORTRAN_ANYD(ffab),
+                                                BL_TO_FORTRAN_ANYD(m),
+                                                cdr, bct, bcl, maxorder, dxinv);
             }
         }
     }
+
+    m_interp_coef_stale[amrlev] = false;
 }
 
 Real
 MLCellLinOp::xdoty (int amrlev, int mglev, const MultiFab& x, const MultiFab& y, bool local) const
 {
-    const int ncomp = 1;
+    const int ncomp = getNComp();
     const int nghost = 0;
     Real result = MultiFab::Dot(x,0,y,0,ncomp,nghost,true);
     if (!local) {
@@ -1,5 +1,6 @@
 
 #include <AMReX_MLLinOp.H>
+#include <AMReX_MLLinOp_F.H>
 #include <AMReX_ParmParse.H>
 
 #ifdef AMREX_USE_EB
@@ -16,6 +17,10 @@ namespace {
     bool initialized = false;
     int consolidation_ratio = 2;
     int consolidation_strategy = 3;
+    // Chebyshev smoother: number of power iterations for the eigenvalue
+    // estimate, and the fraction of the max eigenvalue targeted from below.
+    int cheb_power_iters = 10;
+    Real cheb_eig_ratio = 0.3;
 }
 
 MLLinOp::MLLinOp () {}
@@ -35,6 +40,8 @@ MLLinOp::define (const Vector<Geometry>& a_geom,
 	ParmParse pp("mg");
 	pp.query("consolidation_ratio", consolidation_ratio);
 	pp.query("consolidation_strategy", consolidation_strategy);
+	pp.query("cheb_power_iters", cheb_power_iters);
+	pp.query("cheb_eig_ratio", cheb_eig_ratio);
 	initialized = true;
     }
 
@@ -294,6 +301,153 @@ MLLinOp::make (Vector<Vector<MultiFab> >& mf, int nc, int ng) const
     }
 }
 
+void
+MLLinOp::prepareForChebyshevSmoother ()
+{
+    BL_PROFILE("MLLinOp::prepareForChebyshevSmoother()");
+
+    const int ncomp = getNComp();
+
+    m_cheb_lambda_max.resize(m_num_amr_levels);
+    m_cheb_resid.resize(m_num_amr_levels);
+    m_cheb_dir.resize(m_num_amr_levels);
+    for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
+    {
+        m_cheb_lambda_max[amrlev].resize(m_num_mg_levels[amrlev]);
+        m_cheb_resid[amrlev].resize(m_num_mg_levels[amrlev]);
+        m_cheb_dir[amrlev].resize(m_num_mg_levels[amrlev]);
+        for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
+        {
+            const auto& ba = amrex::convert(m_grids[amrlev][mglev], m_ixtype);
+            const auto& dm = m_dmap[amrlev][mglev];
+            m_cheb_resid[amrlev][mglev].define(ba, dm, ncomp, 0);
+            m_cheb_dir[amrlev][mglev].define(ba, dm, ncomp, 0);
+
+            MultiFab x(ba, dm, ncomp, 1);
+            MultiFab& y = m_cheb_resid[amrlev][mglev];
+
+            // Start with the highest frequency mode, which is close to
+            // the eigenvector we are looking for.
+            x.setVal(0.0);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for (MFIter mfi(x,true); mfi.isValid(); ++mfi)
+            {
+                const Box& bx = mfi.tilebox();
+                FArrayBox& fab = x[mfi];
+                for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv)) {
+                    const Real v = (std::abs(AMREX_D_TERM(iv[0],+iv[1],+iv[2])) % 2 == 0) ? 1.0 : -1.0;
+                    for (int n = 0; n < ncomp; ++n) {
+                        fab(iv,n) = v;
+                    }
+                }
+            }
+
+            // Power iterations on D^{-1} A
+            Real lambda = 0.0;
+            for (int it = 0; it < cheb_power_iters; ++it)
+            {
+                apply(amrlev, mglev, y, x, BCMode::Homogeneous);
+                normalize(amrlev, mglev, y);
+                Real xnorm = 0.0, ynorm = 0.0;
+                for (int n = 0; n < ncomp; ++n) {
+                    xnorm = std::max(xnorm, x.norm0(n));
+                    ynorm = std::max(ynorm, y.norm0(n));
+                }
+                if (xnorm == 0.0 || ynorm == 0.0) break;
+                lambda = ynorm / xnorm;
+                MultiFab::Copy(x, y, 0, 0, ncomp, 0);
+                x.mult(1.0/ynorm, 0, ncomp, 0);
+            }
+
+            m_cheb_lambda_max[amrlev][mglev] = lambda;
+
+            if (verbose >= 2) {
+                amrex::Print() << "MLLinOp: Chebyshev max eigenvalue on level " << amrlev
+                               << ", " << mglev << " = " << lambda << "\n";
+            }
+        }
+    }
+}
+
+// Chebyshev iterations for L(sol) = rhs with homogeneous bc, preconditioned
+// by the diagonal.  The targeted eigenvalue interval of D^{-1} L is
+// [cheb_eig_ratio*lmax, lmax], where lmax is 1.1 times the estimate.
+void
+MLLinOp::chebyshevSmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs) const
+{
+    BL_PROFILE("MLLinOp::chebyshevSmooth()");
+
+    AMREX_ASSERT(!m_cheb_lambda_max.empty());
+
+    const Real lmax  = 1.1 * m_cheb_lambda_max[amrlev][mglev];
+    const Real lmin  = cheb_eig_ratio * lmax;
+    const Real theta = 0.5*(lmax + lmin);
+    const Real delta = 0.5*(lmax - lmin);
+    const Real sigma = theta / delta;
+    Real rho = 1.0 / sigma;
+
+    const int ncomp = getNComp();
+    MultiFab& r = m_cheb_resid[amrlev][mglev];
+    MultiFab& d = m_cheb_dir[amrlev][mglev];
+    AMREX_ASSERT(r.boxArray() == rhs.boxArray() && r.DistributionMap() == rhs.DistributionMap());
+
+    // r = D^{-1} (rhs - L(sol)),  d = r / theta
+    apply(amrlev, mglev, r, sol, BCMode::Homogeneous);
+    MultiFab::Xpay(r, -1.0, rhs, 0, 0, ncomp, 0);
+    normalize(amrlev, mglev, r);
+    MultiFab::LinComb(d, 1.0/theta, r, 0, 0.0, r, 0, 0, ncomp, 0);
+
+    for (int k = 1; k <= m_cheb_degree; ++k)
+    {
+        MultiFab::Add(sol, d, 0, 0, ncomp, 0);
+        if (k == m_cheb_degree) break;
+
+        apply(amrlev, mglev, r, sol, BCMode::Homogeneous);
+        MultiFab::Xpay(r, -1.0, rhs, 0, 0, ncomp, 0);
+        normalize(amrlev, mglev, r);
+
+        const Real rho_new = 1.0 / (2.0*sigma - rho);
+        MultiFab::LinComb(d, rho_new*rho, d, 0, 2.0*rho_new/delta, r, 0, 0, ncomp, 0);
+        rho = rho_new;
+    }
+}
+
+void
+MLLinOp::copyToSP (fMultiFab& dst, const MultiFab& src, Real scale, int ng)
+{
+    BL_PROFILE("MLLinOp::copyToSP()");
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(dst,true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.growntilebox(ng);
+        amrex_mllinop_copy_dtof(BL_TO_FORTRAN_BOX(bx),
+                                BL_TO_FORTRAN_ANYD(dst[mfi]),
+                                BL_TO_FORTRAN_ANYD(src[mfi]),
+                                scale);
+    }
+}
+
+void
+MLLinOp::copyFromSP (MultiFab& dst, const fMultiFab& src, Real scale, int ng)
+{
+    BL_PROFILE("MLLinOp::copyFromSP()");
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(dst,true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.growntilebox(ng);
+        amrex_mllinop_copy_ftod(BL_TO_FORTRAN_BOX(bx),
+                                BL_TO_FORTRAN_ANYD(dst[mfi]),
+                                BL_TO_FORTRAN_ANYD(src[mfi]),
+                                scale);
+    }
+}
+
 void
 MLLinOp::setDomainBC (const std::array<BCType,AMREX_SPACEDIM>& a_lobc,
                       const std::array<BCType,AMREX_SPACEDIM>& a_hibc)
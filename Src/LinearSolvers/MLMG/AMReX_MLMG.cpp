@@ -1,4 +1,7 @@
 
+#include <fstream>
+#include <limits>
+
 #include <AMReX_MLMG.H>
 #include <AMReX_MultiFabUtil.H>
 #include <AMReX_VisMF.H>
@@ -32,7 +35,8 @@ namespace amrex {
 MLMG::MLMG (MLLinOp& a_lp)
     : linop(a_lp),
       namrlevs(a_lp.NAMRLevels()),
-      finest_amr_lev(a_lp.NAMRLevels()-1)
+      finest_amr_lev(a_lp.NAMRLevels()-1),
+      ncomp(a_lp.getNComp())
 {}
 
 MLMG::~MLMG ()
@@ -52,6 +56,8 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
 
     prepareForSolve(a_sol, a_rhs);
 
+    const long start_bytes = FabArrayBase::BytesSent();
+
     computeMLResidual(finest_amr_lev);
 
     bool local = true;
@@ -67,6 +73,11 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
         }
     }
 
+    if (do_instrumentation) {
+        stats.rhs_norm = rhsnorm0;
+        stats.res_history.push_back(resnorm0);
+    }
+
     Real max_norm;
     std::string norm_name;
     if (always_use_bnorm or rhsnorm0 >= resnorm0) {
@@ -132,6 +143,11 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
                 converged = false;
             }
 
+            if (do_instrumentation) {
+                stats.num_iters = iter+1;
+                stats.res_history.push_back(composite_norminf);
+            }
+
             if (converged)
             {
                 if (verbose >= 1) {
@@ -158,11 +174,17 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
     {
         if (a_sol[alev] != sol[alev])
         {
-            MultiFab::Copy(*a_sol[alev], *sol[alev], 0, 0, 1, ng_back);
+            MultiFab::Copy(*a_sol[alev], *sol[alev], 0, 0, ncomp, ng_back);
         }
     }
 
     timer[solve_time] = amrex::second() - solve_start_time;
+    if (do_instrumentation) {
+        stats.solve_time  = timer[solve_time];
+        stats.iter_time   = timer[iter_time];
+        stats.bottom_time = timer[bottom_time];
+        stats.bytes_sent  = FabArrayBase::BytesSent() - start_bytes;
+    }
     if (verbose >= 1) {
         ParallelDescriptor::ReduceRealMax(timer.data(), timer.size());
         amrex::Print() << "MLMG: Timers: Solve = " << timer[solve_time]
@@ -184,7 +206,7 @@ MLMG::oneIter (int iter)
     {
         miniCycle(alev);
 
-        MultiFab::Add(*sol[alev], *cor[alev][0], 0, 0, 1, 0);
+        MultiFab::Add(*sol[alev], *cor[alev][0], 0, 0, ncomp, 0);
 
         // compute residual for the coarse AMR level
         computeResWithCrseSolFineCor(alev-1,alev);
@@ -198,17 +220,21 @@ MLMG::oneIter (int iter)
     {
         // enforce solvability if appropriate
         if (linop.isSingular(0)) {
-            Real offset = res[0][0].sum() / linop.Geom(0,0).Domain().d_numPts();
-            res[0][0].plus(-offset, 0, 1);
+            for (int n = 0; n < ncomp; ++n) {
+                Real offset = res[0][0].sum(n) / linop.Geom(0,0).Domain().d_numPts();
+                res[0][0].plus(-offset, n, 1);
+            }
         }
 
-        if (iter < max_fmg_iters) {
+        if (useMixedPrecision()) {
+            mixedPrecisionCycle();
+        } else if (iter < max_fmg_iters) {
             mgFcycle ();
         } else {
             mgVcycle (0, 0);
         }
 
-        MultiFab::Add(*sol[0], *cor[0][0], 0, 0, 1, 0);
+        MultiFab::Add(*sol[0], *cor[0][0], 0, 0, ncomp, 0);
     }
 
     for (int alev = 1; alev <= finest_amr_lev; ++alev)
@@ -216,10 +242,10 @@ MLMG::oneIter (int iter)
         // (Fine AMR correction) = I(Coarse AMR correction)
         interpCorrection(alev);
 
-        MultiFab::Add(*sol[alev], *cor[alev][0], 0, 0, 1, 0);
+        MultiFab::Add(*sol[alev], *cor[alev][0], 0, 0, ncomp, 0);
 
         if (alev != finest_amr_lev) {
-            MultiFab::Add(*cor_hold[alev][0], *cor[alev][0], 0, 0, 1, 0);
+            MultiFab::Add(*cor_hold[alev][0], *cor[alev][0], 0, 0, ncomp, 0);
         }
 
         // Update fine AMR level correction
@@ -227,10 +253,10 @@ MLMG::oneIter (int iter)
 
         miniCycle(alev);
 
-        MultiFab::Add(*sol[alev], *cor[alev][0], 0, 0, 1, 0);
+        MultiFab::Add(*sol[alev], *cor[alev][0], 0, 0, ncomp, 0);
 
         if (alev != finest_amr_lev) {
-            MultiFab::Add(*cor[alev][0], *cor_hold[alev][0], 0, 0, 1, 0);
+            MultiFab::Add(*cor[alev][0], *cor_hold[alev][0], 0, 0, ncomp, 0);
         }
     }
 
@@ -245,12 +271,14 @@ MLMG::computeMLResidual (int amrlevmax)
 
     const int mglev = 0;
     for (int alev = amrlevmax; alev >= 0; --alev) {
+        startStats();
         const MultiFab* crse_bcdata = (alev > 0) ? sol[alev-1] : nullptr;
         linop.solutionResidual(alev, res[alev][mglev], *sol[alev], rhs[alev], crse_bcdata);
         if (alev < finest_amr_lev) {
             linop.reflux(alev, res[alev][mglev], *sol[alev], rhs[alev],
                          res[alev+1][mglev], *sol[alev+1], rhs[alev+1]);
         }
+        stopStats(alev, mglev, apply_stats);
     }
 }
 
@@ -268,7 +296,9 @@ MLMG::computeResidual (int alev)
     if (alev > 0) {
         crse_bcdata = sol[alev-1];
     }
+    startStats();
     linop.solutionResidual(alev, r, x, b, crse_bcdata);
+    stopStats(alev, 0, apply_stats);
 }
 
 // Compute coarse AMR level composite residual with coarse solution and fine correction
@@ -291,17 +321,23 @@ MLMG::computeResWithCrseSolFineCor (int calev, int falev)
     if (calev > 0) {
         crse_bcdata = sol[calev-1];
     }
+    startStats();
     linop.solutionResidual(calev, crse_res, crse_sol, crse_rhs, crse_bcdata);
+    stopStats(calev, 0, apply_stats);
 
+    startStats();
     linop.correctionResidual(falev, 0, fine_rescor, fine_cor, fine_res, BCMode::Homogeneous);
-    MultiFab::Copy(fine_res, fine_rescor, 0, 0, 1, 0);
+    MultiFab::Copy(fine_res, fine_rescor, 0, 0, ncomp, 0);
+    stopStats(falev, 0, apply_stats);
 
+    startStats();
     linop.reflux(calev, crse_res, crse_sol, crse_rhs, fine_res, fine_sol, fine_rhs);
 
     if (linop.isCellCentered()) {
         const int amrrr = linop.AMRRefRatio(calev);
-        amrex::average_down(fine_res, crse_res, 0, 1, amrrr);
+        amrex::average_down(fine_res, crse_res, 0, ncomp, amrrr);
     }
+    stopStats(calev, 0, restriction_stats);
 }
 
 // Compute fine AMR level residual fine_res = fine_res - L(fine_cor) with coarse providing BC.
@@ -317,9 +353,11 @@ MLMG::computeResWithCrseCorFineCor (int falev)
     MultiFab& fine_rescor = rescor[falev][0];
 
     // fine_rescor = fine_res - L(fine_cor)
+    startStats();
     linop.correctionResidual(falev, 0, fine_rescor, fine_cor, fine_res,
                              BCMode::Inhomogeneous, &crse_cor);
-    MultiFab::Copy(fine_res, fine_rescor, 0, 0, 1, 0);
+    MultiFab::Copy(fine_res, fine_rescor, 0, 0, ncomp, 0);
+    stopStats(falev, 0, apply_stats);
 }
 
 void
@@ -352,6 +390,7 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
                            << "   DN: Norm before smooth " << norm << "\n";
         }
 
+        startStats();
         cor[amrlev][mglev]->setVal(0.0);
         bool skip_fillboundary = true;
         for (int i = 0; i < nu1; ++i) {
@@ -359,6 +398,7 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
                          skip_fillboundary);
             skip_fillboundary = false;
         }
+        stopStats(amrlev, mglev, smooth_stats);
 
         // rescor = res - L(cor)
         computeResOfCorrection(amrlev, mglev);
@@ -370,7 +410,9 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
         }
 
         // res_crse = R(rescor_fine); this provides res/b to the level below
+        startStats();
         linop.restriction(amrlev, mglev+1, res[amrlev][mglev+1], rescor[amrlev][mglev]);
+        stopStats(amrlev, mglev, restriction_stats);
     }
     BL_PROFILE_VAR_STOP(blp_down);
 
@@ -387,6 +429,7 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
     }
     else
     {
+        startStats();
         cor[amrlev][mglev_bottom]->setVal(0.0);
         bool skip_fillboundary = true;
         for (int i = 0; i < nu1; ++i) {
@@ -394,6 +437,7 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
                          skip_fillboundary);
             skip_fillboundary = false;
         }
+        stopStats(amrlev, mglev_bottom, smooth_stats);
     }
     BL_PROFILE_VAR_STOP(blp_bottom);
 
@@ -408,9 +452,11 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
             amrex::Print() << "AT LEVEL "                << mglev << "\n"
                            << "   UP: Norm before smooth " << norm << "\n";
         }
+        startStats();
         for (int i = 0; i < nu2; ++i) {
             linop.smooth(amrlev, mglev, *cor[amrlev][mglev], res[amrlev][mglev]);
         }
+        stopStats(amrlev, mglev, smooth_stats);
         if (verbose >= 4)
         {
             Real norm = res[amrlev][mglev].norm0();
@@ -435,7 +481,9 @@ MLMG::mgFcycle ()
 
     for (int mglev = 1; mglev <= mg_bottom_lev; ++mglev)
     {
-        amrex::average_down(res[amrlev][mglev-1], res[amrlev][mglev], 0, 1, ratio);
+        startStats();
+        amrex::average_down(res[amrlev][mglev-1], res[amrlev][mglev], 0, ncomp, ratio);
+        stopStats(amrlev, mglev-1, restriction_stats);
     }
 
     bottomSolve();
@@ -448,13 +496,135 @@ MLMG::mgFcycle ()
         // rescor = res - L(cor)
         computeResOfCorrection(amrlev, mglev);
         // res = rescor; this provides b to the vcycle below
-        MultiFab::Copy(res[amrlev][mglev], rescor[amrlev][mglev], 0,0,1,0);
+        MultiFab::Copy(res[amrlev][mglev], rescor[amrlev][mglev], 0,0,ncomp,0);
 
         // save cor; do v-cycle; add the saved to cor
         std::swap(cor[amrlev][mglev], cor_hold[amrlev][mglev]);
         mgVcycle(amrlev, mglev);
-        MultiFab::Add(*cor[amrlev][mglev], *cor_hold[amrlev][mglev], 0, 0, 1, 0);
+        MultiFab::Add(*cor[amrlev][mglev], *cor_hold[amrlev][mglev], 0, 0, ncomp, 0);
+    }
+}
+
+bool
+MLMG::useMixedPrecision () const
+{
+    return do_mixed_precision && linop.isCellCentered() && linop.supportsMixedPrecision()
+        && linop.NMGLevels(0) > 1;
+}
+
+// One step of iterative refinement on the coarest AMR level.
+// in  : Residual (res) on the top MG level in double precision
+// out : Correction (cor) on the top MG level in double precision
+// The residual is scaled to O(1) before it is rounded to single
+// precision so that small residuals do not underflow.
+void
+MLMG::mixedPrecisionCycle ()
+{
+    BL_PROFILE("MLMG::mixedPrecisionCycle()");
+
+    const Real scale = res[0][0].norm0();
+    if (scale == 0.0) {
+        cor[0][0]->setVal(0.0);
+        return;
+    }
+
+    MLLinOp::copyToSP(res_sp[0], res[0][0], 1.0/scale, 0);
+
+    mgVcycleSP();
+
+    MLLinOp::copyFromSP(*cor[0][0], *cor_sp[0], scale, 0);
+}
+
+// Single-precision V-cycle on the coarsest AMR level
+// in   : Residual (res_sp) on the top MG level
+// out  : Correction (cor_sp) on all MG levels
+void
+MLMG::mgVcycleSP ()
+{
+    BL_PROFILE("MLMG::mgVcycleSP()");
+
+    const int amrlev = 0;
+    const int mglev_bottom = linop.NMGLevels(amrlev) - 1;
+
+    for (int mglev = 0; mglev < mglev_bottom; ++mglev)
+    {
+        startStats();
+        cor_sp[mglev]->setVal(0.0);
+        bool skip_fillboundary = true;
+        for (int i = 0; i < nu1; ++i) {
+            linop.smoothSP(amrlev, mglev, *cor_sp[mglev], res_sp[mglev], skip_fillboundary);
+            skip_fillboundary = false;
+        }
+        stopStats(amrlev, mglev, smooth_stats);
+
+        // rescor = res - L(cor)
+        startStats();
+        linop.correctionResidualSP(amrlev, mglev, rescor_sp[mglev], *cor_sp[mglev], res_sp[mglev]);
+        stopStats(amrlev, mglev, apply_stats);
+
+        // res_crse = R(rescor_fine)
+        startStats();
+        linop.restrictionSP(amrlev, mglev+1, res_sp[mglev+1], rescor_sp[mglev]);
+        stopStats(amrlev, mglev, restriction_stats);
+    }
+
+    bottomSolveSP();
+
+    for (int mglev = mglev_bottom-1; mglev >= 0; --mglev)
+    {
+        // cor_fine += I(cor_crse)
+        addInterpCorrectionSP(mglev);
+        startStats();
+        for (int i = 0; i < nu2; ++i) {
+            linop.smoothSP(amrlev, mglev, *cor_sp[mglev], res_sp[mglev]);
+        }
+        stopStats(amrlev, mglev, smooth_stats);
+    }
+}
+
+// The bottom MG level is small, so the bottom solve is done in double
+// precision.
+void
+MLMG::bottomSolveSP ()
+{
+    const int mglev = linop.NMGLevels(0) - 1;
+    MLLinOp::copyFromSP(res[0][mglev], res_sp[mglev], 1.0, 0);
+    bottomSolve();
+    MLLinOp::copyToSP(*cor_sp[mglev], *cor[0][mglev], 1.0, 0);
+}
+
+void
+MLMG::addInterpCorrectionSP (int mglev)
+{
+    BL_PROFILE("MLMG::addInterpCorrectionSP()");
+
+    startStats();
+
+    const fMultiFab& crse_cor = *cor_sp[mglev+1];
+    fMultiFab&       fine_cor = *cor_sp[mglev  ];
+
+    const int refratio = 2;
+    fMultiFab cfine;
+    const fMultiFab* cmf;
+
+    if (amrex::isMFIterSafe(crse_cor, fine_cor))
+    {
+        cmf = &crse_cor;
+    }
+    else
+    {
+        BoxArray cba = fine_cor.boxArray();
+        cba.coarsen(refratio);
+        cfine.define(cba, fine_cor.DistributionMap(), 1, 0);
+        const Real comm_start_time = amrex::second();
+        cfine.ParallelCopy(crse_cor);
+        mlmg_comm_time += amrex::second() - comm_start_time;
+        cmf = &cfine;
     }
+
+    linop.interpolationSP(0, mglev, fine_cor, *cmf);
+
+    stopStats(0, mglev, interpolation_stats);
 }
 
 // Interpolate correction from coarse to fine AMR level.
@@ -463,6 +633,8 @@ MLMG::interpCorrection (int alev)
 {
     BL_PROFILE("MLMG::interpCorrection_1");
 
+    startStats();
+
     const MultiFab& crse_cor = *cor[alev-1][0];
     MultiFab& fine_cor = *cor[alev][0];
 
@@ -474,9 +646,11 @@ MLMG::interpCorrection (int alev)
     const Geometry& crse_geom = linop.Geom(alev-1,0);
 
     const int ng = linop.isCellCentered() ? 1 : 0;
-    MultiFab cfine(ba, fine_cor.DistributionMap(), 1, ng);
+    MultiFab cfine(ba, fine_cor.DistributionMap(), ncomp, ng);
     cfine.setVal(0.0);
-    cfine.ParallelCopy(crse_cor, 0, 0, 1, 0, ng, crse_geom.periodicity());
+    const Real comm_start_time = amrex::second();
+    cfine.ParallelCopy(crse_cor, 0, 0, ncomp, 0, ng, crse_geom.periodicity());
+    mlmg_comm_time += amrex::second() - comm_start_time;
 
     if (linop.isCellCentered())
     {
@@ -486,10 +660,12 @@ MLMG::interpCorrection (int alev)
         for (MFIter mfi(fine_cor, MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
         {
             const Box& bx = mfi.tilebox();
-            amrex_mlmg_lin_cc_interp(BL_TO_FORTRAN_BOX(bx),
-                                     BL_TO_FORTRAN_ANYD(fine_cor[mfi]),
-                                     BL_TO_FORTRAN_ANYD(cfine[mfi]),
-                                     &refratio[0]);
+            for (int n = 0; n < ncomp; ++n) {
+                amrex_mlmg_lin_cc_interp(BL_TO_FORTRAN_BOX(bx),
+                                         BL_TO_FORTRAN_N_ANYD(fine_cor[mfi],n),
+                                         BL_TO_FORTRAN_N_ANYD(cfine[mfi],n),
+                                         &refratio[0]);
+            }
         }
     }
     else
@@ -514,6 +690,8 @@ MLMG::interpCorrection (int alev)
             }
         }
     }
+
+    stopStats(alev, 0, interpolation_stats);
 }
 
 // Interpolate correction between MG levels
@@ -524,6 +702,8 @@ MLMG::interpCorrection (int alev, int mglev)
 {
     BL_PROFILE("MLMG::interpCorrection_2");
 
+    startStats();
+
     MultiFab& crse_cor = *cor[alev][mglev+1];
     MultiFab& fine_cor = *cor[alev][mglev  ];
 
@@ -533,6 +713,7 @@ MLMG::interpCorrection (int alev, int mglev)
     MultiFab cfine;
     const MultiFab* cmf;
     
+    const Real comm_start_time = amrex::second();
     if (amrex::isMFIterSafe(crse_cor, fine_cor))
     {
         crse_cor.FillBoundary(crse_geom.periodicity());
@@ -549,6 +730,7 @@ MLMG::interpCorrection (int alev, int mglev)
         cfine.ParallelCopy(crse_cor, 0, 0, nc, 0, ng, crse_geom.periodicity());
         cmf = & cfine;
     }
+    mlmg_comm_time += amrex::second() - comm_start_time;
 
     if (linop.isCellCentered())
     {
@@ -558,10 +740,12 @@ MLMG::interpCorrection (int alev, int mglev)
         for (MFIter mfi(fine_cor, MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
         {
             const Box& bx = mfi.tilebox();
-            amrex_mlmg_lin_cc_interp(BL_TO_FORTRAN_BOX(bx),
-                                     BL_TO_FORTRAN_ANYD(fine_cor[mfi]),
-                                     BL_TO_FORTRAN_ANYD(  (*cmf)[mfi]),
-                                     &refratio);
+            for (int n = 0; n < ncomp; ++n) {
+                amrex_mlmg_lin_cc_interp(BL_TO_FORTRAN_BOX(bx),
+                                         BL_TO_FORTRAN_N_ANYD(fine_cor[mfi],n),
+                                         BL_TO_FORTRAN_N_ANYD(  (*cmf)[mfi],n),
+                                         &refratio);
+            }
         }
     }
     else
@@ -585,6 +769,8 @@ MLMG::interpCorrection (int alev, int mglev)
             }
         }
     }
+
+    stopStats(alev, mglev, interpolation_stats);
 }
 
 // (Fine MG level correction) += I(Coarse MG level correction)
@@ -593,6 +779,8 @@ MLMG::addInterpCorrection (int alev, int mglev)
 {
     BL_PROFILE("MLMG::addInterpCorrection()");
 
+    startStats();
+
     const MultiFab& crse_cor = *cor[alev][mglev+1];
     MultiFab&       fine_cor = *cor[alev][mglev  ];
 
@@ -611,11 +799,15 @@ MLMG::addInterpCorrection (int alev, int mglev)
         const int nc = crse_cor.nComp();
         const int ng = 0;
         cfine.define(cba, fine_cor.DistributionMap(), nc, ng);
+        const Real comm_start_time = amrex::second();
         cfine.ParallelCopy(crse_cor);
+        mlmg_comm_time += amrex::second() - comm_start_time;
         cmf = &cfine;
     }
 
     linop.interpolation(alev, mglev, fine_cor, *cmf);
+
+    stopStats(alev, mglev, interpolation_stats);
 }
 
 // Compute rescor = res - L(cor)
@@ -629,7 +821,9 @@ MLMG::computeResOfCorrection (int amrlev, int mglev)
     MultiFab& x = *cor[amrlev][mglev];
     const MultiFab& b = res[amrlev][mglev];
     MultiFab& r = rescor[amrlev][mglev];
+    startStats();
     linop.correctionResidual(amrlev, mglev, r, x, b, BCMode::Homogeneous);
+    stopStats(amrlev, mglev, apply_stats);
 }
 
 // At the true bottom of the coarset AMR level.
@@ -681,6 +875,8 @@ MLMG::actualBottomSolve ()
 
     x.setVal(0.0);
 
+    if (do_instrumentation) ++stats.num_bottom_solves;
+
     if (bottom_solver == BottomSolver::smoother)
     {
         bool skip_fillboundary = true;
@@ -688,6 +884,7 @@ MLMG::actualBottomSolve ()
             linop.smooth(amrlev, mglev, x, b, skip_fillboundary);
             skip_fillboundary = false;
         }
+        if (do_instrumentation) stats.bottom_iters += nuf;
     }
     else
     {
@@ -695,17 +892,22 @@ MLMG::actualBottomSolve ()
         MultiFab raii_b;
         if (linop.isBottomSingular())
         {
-            raii_b.define(b.boxArray(), b.DistributionMap(), 1, b.nGrow());
-            MultiFab::Copy(raii_b,b,0,0,1,b.nGrow());
+            raii_b.define(b.boxArray(), b.DistributionMap(), ncomp, b.nGrow());
+            MultiFab::Copy(raii_b,b,0,0,ncomp,b.nGrow());
             bottom_b = &raii_b;
 
-            Real offset;
             if (linop.isCellCentered())
             {
                 const bool local = true;
-                offset = bottom_b->sum(0,local)
-                    / linop.Geom(amrlev,mglev).Domain().d_numPts();
-                ParallelAllReduce::Sum(offset, linop.BottomCommunicator());
+                Vector<Real> offset(ncomp);
+                for (int n = 0; n < ncomp; ++n) {
+                    offset[n] = bottom_b->sum(n,local)
+                        / linop.Geom(amrlev,mglev).Domain().d_numPts();
+                }
+                ParallelAllReduce::Sum(offset.data(), ncomp, linop.BottomCommunicator());
+                for (int n = 0; n < ncomp; ++n) {
+                    bottom_b->plus(-offset[n], n, 1);
+                }
             }
             else
             {
@@ -715,10 +917,9 @@ MLMG::actualBottomSolve ()
                 Real s1 = linop.xdoty(amrlev, mglev, *bottom_b, one, local);
                 Real s2 = linop.xdoty(amrlev, mglev, one, one, local);
                 ParallelAllReduce::Sum<Real>({s1,s2}, linop.BottomCommunicator());
-                offset = s1/s2;
+                const Real offset = s1/s2;
+                bottom_b->plus(-offset, 0, 1);
             }
-
-            bottom_b->plus(-offset, 0, 1);
         }
 
         if (bottom_solver == BottomSolver::hypre)
@@ -734,6 +935,7 @@ MLMG::actualBottomSolve ()
             const Real cg_rtol = 1.e-4;
             const Real cg_atol = -1.0;
             int ret = cg_solver.solve(x, *bottom_b, cg_rtol, cg_atol);
+            if (do_instrumentation) stats.bottom_iters += cg_solver.getNumIters();
             if (ret != 0 && verbose >= 1) {
                 amrex::Print() << "MLMG: Bottom solve failed.\n";
             }
@@ -755,11 +957,16 @@ MLMG::ResNormInf (int alev, bool local)
 {
     BL_PROFILE("MLMG::ResNormInf()");
     const int mglev = 0;
-    if (fine_mask[alev]) {
-        return res[alev][mglev].norm0(*fine_mask[alev],0,0,local);
-    } else {
-        return res[alev][mglev].norm0(0,0,local);
+    Real r = 0.0;
+    for (int n = 0; n < ncomp; ++n) {
+        if (fine_mask[alev]) {
+            r = std::max(r, res[alev][mglev].norm0(*fine_mask[alev],n,0,true));
+        } else {
+            r = std::max(r, res[alev][mglev].norm0(n,0,true));
+        }
     }
+    if (!local) ParallelDescriptor::ReduceRealMax(r);
+    return r;
 }
 
 // Computes multi-level masked inf-norm of Residual (res).
@@ -784,10 +991,12 @@ MLMG::MLRhsNormInf (bool local)
     Real r = 0.0;
     for (int alev = 0; alev <= finest_amr_lev; ++alev)
     {
-        if (alev < finest_amr_lev) {
-            r = std::max(r, rhs[alev].norm0(*fine_mask[alev],0,0,local));
-        } else {
-            r = std::max(r, rhs[alev].norm0(0,0,local));
+        for (int n = 0; n < ncomp; ++n) {
+            if (alev < finest_amr_lev) {
+                r = std::max(r, rhs[alev].norm0(*fine_mask[alev],n,0,local));
+            } else {
+                r = std::max(r, rhs[alev].norm0(n,0,local));
+            }
         }
     }
     return r;
@@ -843,31 +1052,29 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
 
     timer.assign(ntimers, 0.0);
 
-    linop.prepareForSolve();
+    prepareLinOp();
 
-    sol.resize(namrlevs);
-    sol_raii.resize(namrlevs);
-    for (int alev = 0; alev < namrlevs; ++alev)
+    if (do_instrumentation)
     {
-        if (a_sol[alev]->nGrow() == 1)
-        {
-            sol[alev] = a_sol[alev];
-        }
-        else
-        {
-            sol_raii[alev].reset(new MultiFab(a_sol[alev]->boxArray(),
-                                              a_sol[alev]->DistributionMap(), 1, 1));
-            sol_raii[alev]->setVal(0.0);
-            MultiFab::Copy(*sol_raii[alev], *a_sol[alev], 0, 0, 1, 0);
-            sol[alev] = sol_raii[alev].get();
+        stats = SolveStats();
+        stats.levels.resize(namrlevs);
+        for (int alev = 0; alev < namrlevs; ++alev) {
+            stats.levels[alev].resize(linop.NMGLevels(alev));
         }
     }
+
+    setSolAlias(a_sol);
     
     rhs.resize(namrlevs);
     for (int alev = 0; alev < namrlevs; ++alev)
     {
-        rhs[alev].define(a_rhs[alev]->boxArray(), a_rhs[alev]->DistributionMap(), 1, 0);
-        MultiFab::Copy(rhs[alev], *a_rhs[alev], 0, 0, 1, 0);
+        if (rhs[alev].empty()
+            || rhs[alev].boxArray() != a_rhs[alev]->boxArray()
+            || rhs[alev].DistributionMap() != a_rhs[alev]->DistributionMap())
+        {
+            rhs[alev].define(a_rhs[alev]->boxArray(), a_rhs[alev]->DistributionMap(), ncomp, 0);
+        }
+        MultiFab::Copy(rhs[alev], *a_rhs[alev], 0, 0, ncomp, 0);
         linop.applyMetricTerm(alev, 0, rhs[alev]);
     }
 
@@ -879,16 +1086,116 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
     // enforce solvability if appropriate
     if (linop.isSingular(0))
     {
-        Real offset = rhs[0].sum() / linop.Geom(0,0).Domain().d_numPts();
-        if (verbose >= 4) {
-            amrex::Print() << "MLMG: Subtracting " << offset << " from rhs\n";
+        for (int n = 0; n < ncomp; ++n)
+        {
+            Real offset = rhs[0].sum(n) / linop.Geom(0,0).Domain().d_numPts();
+            if (verbose >= 4) {
+                amrex::Print() << "MLMG: Subtracting " << offset << " from rhs\n";
+            }
+            for (int alev = 0; alev < namrlevs; ++alev) {
+                rhs[alev].plus(-offset, n, 1);
+            }
         }
-        for (int alev = 0; alev < namrlevs; ++alev) {
-            rhs[alev].plus(-offset, 0, 1);
+    }
+
+    allocateBuffers();
+
+    if (useMixedPrecision() && res_sp.empty())
+    {
+        allocateBuffersSP();
+    }
+
+    if (linop.m_parent) do_nsolve = false;  // no embeded N-Solve
+    if (linop.m_domain_covered[0]) do_nsolve = false;
+    if (linop.doAgglomeration()) do_nsolve = false;
+    if (AMREX_SPACEDIM != 3) do_nsolve = false;
+    if (ncomp > 1) do_nsolve = false;
+
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(ncomp == 1 || bottom_solver != BottomSolver::hypre,
+                                     "MLMG: hypre bottom solver only supports one component");
+
+    if (do_nsolve && ns_linop == nullptr)
+    {
+        prepareForNSolve();
+    }
+
+    if (verbose >= 2) {
+        amrex::Print() << "MLMG: # of AMR levels: " << namrlevs << "\n"
+                       << "      # of MG levels on the coarsest AMR level: " << linop.NMGLevels(0)
+                       << "\n";
+        if (ns_linop) {
+            amrex::Print() << "      # of MG levels in N-Solve: " << ns_linop->NMGLevels(0) << "\n"
+                           << "      # of grids in N-Solve: " << ns_linop->m_grids[0][0].size() << "\n";
+        }
+    }
+}
+
+// The full linop setup is only done once.  After that, only the parts
+// that depend on modified coefficients or bc are redone.
+void
+MLMG::prepareLinOp ()
+{
+    if (!linop_prepared)
+    {
+        linop.prepareForSolve();
+        linop_prepared = true;
+        linop_sp_prepared = false;
+        linop_cheb_prepared = false;
+    }
+    else if (linop.needsUpdate())
+    {
+        linop.update();
+        linop_sp_prepared = false;
+        linop_cheb_prepared = false;
+
+#ifdef AMREX_USE_HYPRE
+        // The Hypre bottom solver holds a copy of the old coefficients.
+        hypre_solver.reset();
+        hypre_bndry.reset();
+#endif
+    }
+
+    if (useMixedPrecision() && !linop_sp_prepared)
+    {
+        linop.prepareForMixedPrecision();
+        linop_sp_prepared = true;
+    }
+
+    if (linop.useChebyshevSmoother() && !linop_cheb_prepared)
+    {
+        linop.prepareForChebyshevSmoother();
+        linop_cheb_prepared = true;
+    }
+}
+
+// The MG hierarchy only depends on the grids of the linop, which do
+// not change.  So the buffers are allocated once and reused.
+void
+MLMG::allocateBuffers ()
+{
+    const int nc = ncomp;
+
+    if (buffers_allocated)
+    {
+        for (int alev = 0; alev <= finest_amr_lev; ++alev)
+        {
+            const int nmglevs = linop.NMGLevels(alev);
+            for (int mglev = 0; mglev < nmglevs; ++mglev)
+            {
+                rescor[alev][mglev].setVal(0.0);
+                cor[alev][mglev]->setVal(0.0);
+            }
         }
+        for (auto& v : cor_hold) {
+            for (auto& mf : v) {
+                if (mf) mf->setVal(0.0);
+            }
+        }
+        return;
     }
 
-    const int nc = 1;
+    BL_PROFILE("MLMG::allocateBuffers()");
+
     int ng = linop.isCellCentered() ? 0 : 1;
     linop.make(res, nc, ng);
     linop.make(rescor, nc, ng);
@@ -940,23 +1247,55 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
 
     buildFineMask();
 
-    if (linop.m_parent) do_nsolve = false;  // no embeded N-Solve
-    if (linop.m_domain_covered[0]) do_nsolve = false;
-    if (linop.doAgglomeration()) do_nsolve = false;
-    if (AMREX_SPACEDIM != 3) do_nsolve = false;
+    buffers_allocated = true;
+}
 
-    if (do_nsolve && ns_linop == nullptr)
+void
+MLMG::allocateBuffersSP ()
+{
+    BL_PROFILE("MLMG::allocateBuffersSP()");
+
+    const int amrlev = 0;
+    const int nmglevs = linop.NMGLevels(amrlev);
+    res_sp.resize(nmglevs);
+    rescor_sp.resize(nmglevs);
+    cor_sp.resize(nmglevs);
+    for (int mglev = 0; mglev < nmglevs; ++mglev)
     {
-        prepareForNSolve();
+        const BoxArray& ba = res[amrlev][mglev].boxArray();
+        const DistributionMapping& dm = res[amrlev][mglev].DistributionMap();
+        res_sp[mglev].define(ba, dm, 1, 0);
+        rescor_sp[mglev].define(ba, dm, 1, 0);
+        cor_sp[mglev].reset(new fMultiFab(ba, dm, 1, 1));
+        cor_sp[mglev]->setVal(0.0);
     }
+}
 
-    if (verbose >= 2) {
-        amrex::Print() << "MLMG: # of AMR levels: " << namrlevs << "\n"
-                       << "      # of MG levels on the coarsest AMR level: " << linop.NMGLevels(0)
-                       << "\n";
-        if (ns_linop) {
-            amrex::Print() << "      # of MG levels in N-Solve: " << ns_linop->NMGLevels(0) << "\n"
-                           << "      # of grids in N-Solve: " << ns_linop->m_grids[0][0].size() << "\n";
+// sol is an alias to a_sol if it has one ghost cell.  Otherwise, a
+// copy with one ghost cell is made and kept for the next call.
+void
+MLMG::setSolAlias (const Vector<MultiFab*>& a_sol)
+{
+    sol.resize(namrlevs);
+    sol_raii.resize(namrlevs);
+    for (int alev = 0; alev < namrlevs; ++alev)
+    {
+        if (a_sol[alev]->nGrow() == 1)
+        {
+            sol[alev] = a_sol[alev];
+        }
+        else
+        {
+            if (sol_raii[alev] == nullptr
+                || sol_raii[alev]->boxArray() != a_sol[alev]->boxArray()
+                || sol_raii[alev]->DistributionMap() != a_sol[alev]->DistributionMap())
+            {
+                sol_raii[alev].reset(new MultiFab(a_sol[alev]->boxArray(),
+                                                  a_sol[alev]->DistributionMap(), ncomp, 1));
+            }
+            sol_raii[alev]->setVal(0.0);
+            MultiFab::Copy(*sol_raii[alev], *a_sol[alev], 0, 0, ncomp, 0);
+            sol[alev] = sol_raii[alev].get();
         }
     }
 }
@@ -1014,27 +1353,9 @@ MLMG::compResidual (const Vector<MultiFab*>& a_res, const Vector<MultiFab*>& a_s
 {
     BL_PROFILE("MLMG::compResidual()");
 
-    sol.resize(namrlevs);
-    sol_raii.resize(namrlevs);
-    for (int alev = 0; alev < namrlevs; ++alev)
-    {
-        if (a_sol[alev]->nGrow() == 1)
-        {
-            sol[alev] = a_sol[alev];
-        }
-        else
-        {
-            if (sol_raii[alev] == nullptr)
-            {
-                sol_raii[alev].reset(new MultiFab(a_sol[alev]->boxArray(),
-                                                  a_sol[alev]->DistributionMap(), 1, 1));
-            }
-            MultiFab::Copy(*sol_raii[alev], *a_sol[alev], 0, 0, 1, 0);
-            sol[alev] = sol_raii[alev].get();
-        }
-    }
+    setSolAlias(a_sol);
 
-    linop.prepareForSolve();
+    prepareLinOp();
     
     const auto& amrrr = linop.AMRRefRatio();
 
@@ -1042,8 +1363,8 @@ MLMG::compResidual (const Vector<MultiFab*>& a_res, const Vector<MultiFab*>& a_s
         const MultiFab* crse_bcdata = (alev > 0) ? sol[alev-1] : nullptr;
         const MultiFab* prhs = a_rhs[alev];
 #if (AMREX_SPACEDIM != 3)
-        MultiFab rhstmp(prhs->boxArray(), prhs->DistributionMap(), 1, 0);
-        MultiFab::Copy(rhstmp, *prhs, 0, 0, 1, 0);
+        MultiFab rhstmp(prhs->boxArray(), prhs->DistributionMap(), ncomp, 0);
+        MultiFab::Copy(rhstmp, *prhs, 0, 0, ncomp, 0);
         linop.applyMetricTerm(alev, 0, rhstmp);
         prhs = &rhstmp;
 #endif
@@ -1052,7 +1373,7 @@ MLMG::compResidual (const Vector<MultiFab*>& a_res, const Vector<MultiFab*>& a_s
             linop.reflux(alev, *a_res[alev], *sol[alev], *prhs,
                          *a_res[alev+1], *sol[alev+1], *a_rhs[alev+1]);
             if (linop.isCellCentered()) {
-                amrex::average_down(*a_res[alev+1], *a_res[alev], 0, 1, amrrr[alev]);
+                amrex::average_down(*a_res[alev+1], *a_res[alev], 0, ncomp, amrrr[alev]);
             }
         }
     }
@@ -1074,7 +1395,9 @@ MLMG::averageDownAndSync ()
     {
         for (int falev = finest_amr_lev; falev > 0; --falev)
         {
-            amrex::average_down(*sol[falev], *sol[falev-1], 0, 1, amrrr[falev-1]);
+            startStats();
+            amrex::average_down(*sol[falev], *sol[falev-1], 0, ncomp, amrrr[falev-1]);
+            stopStats(falev-1, 0, restriction_stats);
         }
     }
     else
@@ -1094,6 +1417,136 @@ MLMG::averageDownAndSync ()
     }
 }
 
+void
+MLMG::startStats ()
+{
+    if (!do_instrumentation) return;
+    stats_start_comm_time = linop.m_comm_time + mlmg_comm_time;
+    stats_start_bytes = FabArrayBase::BytesSent();
+    stats_start_time = amrex::second();
+}
+
+// Add the time and bytes since the last startStats() to the record of
+// (amrlev,mglev).  The communication time is not counted in the time of
+// the operation.
+void
+MLMG::stopStats (int amrlev, int mglev, int type)
+{
+    if (!do_instrumentation) return;
+    const Real t = amrex::second() - stats_start_time;
+    const Real tcomm = linop.m_comm_time + mlmg_comm_time - stats_start_comm_time;
+
+    LevelStats& ls = stats.levels[amrlev][mglev];
+    ls.comm_time  += tcomm;
+    ls.bytes_sent += FabArrayBase::BytesSent() - stats_start_bytes;
+    switch (type)
+    {
+    case smooth_stats:
+        ls.smooth_time += t - tcomm;
+        break;
+    case apply_stats:
+        ls.apply_time += t - tcomm;
+        break;
+    case restriction_stats:
+        ls.restriction_time += t - tcomm;
+        break;
+    case interpolation_stats:
+        ls.interpolation_time += t - tcomm;
+        break;
+    }
+}
+
+void
+MLMG::SolveStats::writeJSON (std::ostream& os) const
+{
+    const auto old_prec = os.precision(std::numeric_limits<Real>::digits10 + 1);
+
+    os << "{\n"
+       << "  \"num_iters\": " << num_iters << ",\n"
+       << "  \"num_bottom_solves\": " << num_bottom_solves << ",\n"
+       << "  \"bottom_iters\": " << bottom_iters << ",\n"
+       << "  \"solve_time\": " << solve_time << ",\n"
+       << "  \"iter_time\": " << iter_time << ",\n"
+       << "  \"bottom_time\": " << bottom_time << ",\n"
+       << "  \"bytes_sent\": " << bytes_sent << ",\n"
+       << "  \"rhs_norm\": " << rhs_norm << ",\n"
+       << "  \"res_history\": [";
+    for (int i = 0; i < res_history.size(); ++i) {
+        os << (i > 0 ? ", " : "") << res_history[i];
+    }
+    os << "],\n"
+       << "  \"levels\": [\n";
+    for (int alev = 0; alev < levels.size(); ++alev)
+    {
+        os << "    [\n";
+        for (int mglev = 0; mglev < levels[alev].size(); ++mglev)
+        {
+            const LevelStats& ls = levels[alev][mglev];
+            os << "      {\"amrlev\": " << alev
+               << ", \"mglev\": " << mglev
+               << ", \"smooth_time\": " << ls.smooth_time
+               << ", \"apply_time\": " << ls.apply_time
+               << ", \"restriction_time\": " << ls.restriction_time
+               << ", \"interpolation_time\": " << ls.interpolation_time
+               << ", \"comm_time\": " << ls.comm_time
+               << ", \"bytes_sent\": " << ls.bytes_sent << "}"
+               << (mglev+1 < levels[alev].size() ? ",\n" : "\n");
+        }
+        os << "    ]" << (alev+1 < levels.size() ? ",\n" : "\n");
+    }
+    os << "  ]\n"
+       << "}\n";
+
+    os.precision(old_prec);
+}
+
+void
+MLMG::writeSolveStats (const std::string& file_name) const
+{
+    SolveStats s = stats;
+
+    Vector<Real> times {s.solve_time, s.iter_time, s.bottom_time};
+    Vector<long> bytes {s.bytes_sent};
+    for (const auto& lev : s.levels) {
+        for (const auto& ls : lev) {
+            times.push_back(ls.smooth_time);
+            times.push_back(ls.apply_time);
+            times.push_back(ls.restriction_time);
+            times.push_back(ls.interpolation_time);
+            times.push_back(ls.comm_time);
+            bytes.push_back(ls.bytes_sent);
+        }
+    }
+
+    ParallelDescriptor::ReduceRealMax(times.data(), times.size());
+    ParallelDescriptor::ReduceLongSum(bytes.data(), bytes.size());
+
+    s.solve_time  = times[0];
+    s.iter_time   = times[1];
+    s.bottom_time = times[2];
+    s.bytes_sent  = bytes[0];
+    int it = 3, ib = 1;
+    for (auto& lev : s.levels) {
+        for (auto& ls : lev) {
+            ls.smooth_time        = times[it++];
+            ls.apply_time         = times[it++];
+            ls.restriction_time   = times[it++];
+            ls.interpolation_time = times[it++];
+            ls.comm_time          = times[it++];
+            ls.bytes_sent         = bytes[ib++];
+        }
+    }
+
+    if (ParallelDescriptor::IOProcessor())
+    {
+        std::ofstream ofs(file_name);
+        if (!ofs.good()) {
+            amrex::FileOpenFailed(file_name);
+        }
+        s.writeJSON(ofs);
+    }
+}
+
 void
 MLMG::bottomSolveWithHypre (MultiFab& x, const MultiFab& b)
 {
@@ -97,6 +97,7 @@ void
 MLNodeLaplacian::setSigma (int amrlev, const MultiFab& a_sigma)
 {
     MultiFab::Copy(*m_sigma[amrlev][0][0], a_sigma, 0, 0, 1, 0);
+    m_needs_update = true;
 }
 
 void
@@ -739,10 +740,12 @@ MLNodeLaplacian::buildStencil ()
     {
         for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
         {
-            m_stencil[amrlev][mglev].reset
-                (new MultiFab(amrex::convert(m_grids[amrlev][mglev],
-                                             IntVect::TheNodeVector()),
-                              m_dmap[amrlev][mglev], ncomp, 4));
+            if (m_stencil[amrlev][mglev] == nullptr) {
+                m_stencil[amrlev][mglev].reset
+                    (new MultiFab(amrex::convert(m_grids[amrlev][mglev],
+                                                 IntVect::TheNodeVector()),
+                                  m_dmap[amrlev][mglev], ncomp, 4));
+            }
             m_stencil[amrlev][mglev]->setVal(0.0);
         }
 
@@ -943,6 +946,26 @@ MLNodeLaplacian::prepareForSolve ()
 #endif
 
     buildStencil();
+
+    m_needs_update = false;
+}
+
+void
+MLNodeLaplacian::update ()
+{
+    BL_PROFILE("MLNodeLaplacian::update()");
+
+    // Masks and the EB connection only depend on the grids, which have
+    // not changed.  Only the coefficients need to be coarsened again.
+    averageDownCoeffs();
+
+#if (AMREX_SPACEDIM == 2)
+    amrex_mlndlap_set_rz(&m_is_rz);
+#endif
+
+    buildStencil();
+
+    m_needs_update = false;
 }
 
 void
@@ -992,7 +1015,9 @@ MLNodeLaplacian::restriction (int amrlev, int cmglev, MultiFab& crse, MultiFab&
     }
 
     if (need_parallel_copy) {
+        const Real comm_start_time = amrex::second();
         crse.ParallelCopy(cfine);
+        m_comm_time += amrex::second() - comm_start_time;
     }
 }
 
@@ -1010,7 +1035,9 @@ MLNodeLaplacian::interpolation (int amrlev, int fmglev, MultiFab& fine, const Mu
     if (need_parallel_copy) {
         const BoxArray& ba = amrex::coarsen(fine.boxArray(), 2);
         cfine.define(ba, fine.DistributionMap(), 1, 0);
+        const Real comm_start_time = amrex::second();
         cfine.ParallelCopy(crse);
+        m_comm_time += amrex::second() - comm_start_time;
         cmf = &cfine;
     }
 
@@ -1098,7 +1125,9 @@ MLNodeLaplacian::applyBC (int amrlev, int mglev, MultiFab& phi, BCMode/* bc_mode
     const Box& nd_domain = amrex::surroundingNodes(geom.Domain());
 
     if (!skip_fillboundary) {
+        const Real comm_start_time = amrex::second();
         phi.FillBoundary(geom.periodicity());
+        m_comm_time += amrex::second() - comm_start_time;
     }
 
 //    int inhom = (bc_mode == BCMode::Inhomogeneous);
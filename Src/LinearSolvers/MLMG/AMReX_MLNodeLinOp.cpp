@@ -150,6 +150,10 @@ void
 MLNodeLinOp::smooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
                      bool skip_fillboundary) const
 {
+    if (useChebyshevSmoother()) {
+        chebyshevSmooth(amrlev, mglev, sol, rhs);
+        return;
+    }
     if (!skip_fillboundary) {
         applyBC(amrlev, mglev, sol, BCMode::Homogeneous);
     }
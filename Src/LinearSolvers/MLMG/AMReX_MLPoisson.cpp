@@ -35,6 +35,22 @@ MLPoisson::prepareForSolve ()
 
     MLCellLinOp::prepareForSolve();
 
+    updateSingularFlag();
+}
+
+void
+MLPoisson::update ()
+{
+    BL_PROFILE("MLPoisson::update()");
+
+    MLCellLinOp::update();
+
+    updateSingularFlag();
+}
+
+void
+MLPoisson::updateSingularFlag ()
+{
     m_is_singular.clear();
     m_is_singular.resize(m_num_amr_levels, false);
     auto itlo = std::find(m_lobc.begin(), m_lobc.end(), BCType::Dirichlet);
@@ -235,6 +251,113 @@ MLPoisson::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, i
     }
 }
 
+void
+MLPoisson::FapplySP (int amrlev, int mglev, fMultiFab& out, const fMultiFab& in) const
+{
+    BL_PROFILE("MLPoisson::FapplySP()");
+
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(out, true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+#if (AMREX_SPACEDIM != 3)
+        const auto& mfac = *m_metric_factor[amrlev][mglev];
+        const auto& rc = mfac.cellCenters(mfi);
+        const auto& re = mfac.cellEdges(mfi);
+        const Box& vbx = mfi.validbox();
+#endif
+        amrex_mlpoisson_adotx_sp(BL_TO_FORTRAN_BOX(bx),
+                                 BL_TO_FORTRAN_ANYD(out[mfi]),
+                                 BL_TO_FORTRAN_ANYD(in[mfi]),
+#if (AMREX_SPACEDIM != 3)
+                                 rc.data(), re.data(), vbx.loVect(), vbx.hiVect(),
+#endif
+                                 dxinv);
+    }
+}
+
+void
+MLPoisson::FsmoothSP (int amrlev, int mglev, fMultiFab& sol, const fMultiFab& rhs, int redblack) const
+{
+    BL_PROFILE("MLPoisson::FsmoothSP()");
+
+    const auto& undrrelxr = m_undrrelxr[amrlev][mglev];
+    const auto& maskvals  = m_maskvals [amrlev][mglev];
+
+    OrientationIter oitr;
+
+    const FabSet& f0 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f1 = undrrelxr[oitr()]; ++oitr;
+#if (AMREX_SPACEDIM > 1)
+    const FabSet& f2 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f3 = undrrelxr[oitr()]; ++oitr;
+#if (AMREX_SPACEDIM > 2)
+    const FabSet& f4 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f5 = undrrelxr[oitr()]; ++oitr;
+#endif
+#endif
+
+    const MultiMask& mm0 = maskvals[0];
+    const MultiMask& mm1 = maskvals[1];
+#if (AMREX_SPACEDIM > 1)
+    const MultiMask& mm2 = maskvals[2];
+    const MultiMask& mm3 = maskvals[3];
+#if (AMREX_SPACEDIM > 2)
+    const MultiMask& mm4 = maskvals[4];
+    const MultiMask& mm5 = maskvals[5];
+#endif
+#endif
+
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(sol,MFItInfo().EnableTiling().SetDynamic(true));
+         mfi.isValid(); ++mfi)
+    {
+        const Box& tbx = mfi.tilebox();
+        const Box& vbx = mfi.validbox();
+#if (AMREX_SPACEDIM != 3)
+        const auto& mfac = *m_metric_factor[amrlev][mglev];
+        const auto& rc = mfac.cellCenters(mfi);
+        const auto& re = mfac.cellEdges(mfi);
+#endif
+
+        amrex_mlpoisson_gsrb_sp(BL_TO_FORTRAN_BOX(tbx),
+                                BL_TO_FORTRAN_ANYD(sol[mfi]),
+                                BL_TO_FORTRAN_ANYD(rhs[mfi]),
+                                BL_TO_FORTRAN_ANYD(f0[mfi]),
+                                BL_TO_FORTRAN_ANYD(f1[mfi]),
+#if (AMREX_SPACEDIM > 1)
+                                BL_TO_FORTRAN_ANYD(f2[mfi]),
+                                BL_TO_FORTRAN_ANYD(f3[mfi]),
+#if (AMREX_SPACEDIM > 2)
+                                BL_TO_FORTRAN_ANYD(f4[mfi]),
+                                BL_TO_FORTRAN_ANYD(f5[mfi]),
+#endif
+#endif
+                                BL_TO_FORTRAN_ANYD(mm0[mfi]),
+                                BL_TO_FORTRAN_ANYD(mm1[mfi]),
+#if (AMREX_SPACEDIM > 1)
+                                BL_TO_FORTRAN_ANYD(mm2[mfi]),
+                                BL_TO_FORTRAN_ANYD(mm3[mfi]),
+#if (AMREX_SPACEDIM > 2)
+                                BL_TO_FORTRAN_ANYD(mm4[mfi]),
+                                BL_TO_FORTRAN_ANYD(mm5[mfi]),
+#endif
+#endif
+#if (AMREX_SPACEDIM != 3)
+                                rc.data(), re.data(),
+#endif
+                                BL_TO_FORTRAN_BOX(vbx), dxinv, redblack);
+    }
+}
+
 void
 MLPoisson::FFlux (int amrlev, const MFIter& mfi,
                   const std::array<FArrayBox*,AMREX_SPACEDIM>& flux,
@@ -0,0 +1,228 @@
+
+#include <AMReX_MLTensorOp.H>
+#include <AMReX_MLTensor_F.H>
+
+namespace amrex {
+
+MLTensorOp::MLTensorOp (const Vector<Geometry>& a_geom,
+                        const Vector<BoxArray>& a_grids,
+                        const Vector<DistributionMapping>& a_dmap,
+                        const LPInfo& a_info,
+                        const Vector<FabFactory<FArrayBox> const*>& a_factory)
+{
+    m_ncomp = AMREX_SPACEDIM;
+    define(a_geom, a_grids, a_dmap, a_info, a_factory);
+}
+
+MLTensorOp::~MLTensorOp ()
+{}
+
+void
+MLTensorOp::define (const Vector<Geometry>& a_geom,
+                    const Vector<BoxArray>& a_grids,
+                    const Vector<DistributionMapping>& a_dmap,
+                    const LPInfo& a_info,
+                    const Vector<FabFactory<FArrayBox> const*>& a_factory)
+{
+    BL_PROFILE("MLTensorOp::define()");
+
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(a_geom[0].IsCartesian(),
+                                     "MLTensorOp: only Cartesian coordinates are supported");
+
+    m_ncomp = AMREX_SPACEDIM;
+
+    MLABecLaplacian::define(a_geom, a_grids, a_dmap, a_info, a_factory);
+
+    m_edge_mask.resize(m_num_amr_levels);
+    m_rhs_cross.resize(m_num_amr_levels);
+    for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
+    {
+        m_edge_mask[amrlev].resize(m_num_mg_levels[amrlev]);
+        m_rhs_cross[amrlev].resize(m_num_mg_levels[amrlev]);
+        for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
+        {
+            iMultiFab& mask = m_edge_mask[amrlev][mglev];
+            mask.define(m_grids[amrlev][mglev], m_dmap[amrlev][mglev], 1, 1);
+            mask.setVal(0);
+            mask.setVal(1, 0, 1, 0);
+            mask.FillBoundary(m_geom[amrlev][mglev].periodicity());
+
+            m_rhs_cross[amrlev][mglev].define(m_grids[amrlev][mglev], m_dmap[amrlev][mglev],
+                                              m_ncomp, 0);
+        }
+    }
+}
+
+void
+MLTensorOp::setShearViscosity (int amrlev, const std::array<MultiFab const*,AMREX_SPACEDIM>& eta)
+{
+    std::array<MultiFab,AMREX_SPACEDIM> b;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+    {
+        b[idim].define(eta[idim]->boxArray(), eta[idim]->DistributionMap(), m_ncomp, 0);
+        for (int n = 0; n < m_ncomp; ++n) {
+            MultiFab::Copy(b[idim], *eta[idim], 0, n, 1, 0);
+        }
+        // d/dx_i (eta du_i/dx_i) appears in both grad u and (grad u)^T.
+        b[idim].mult(2.0, idim, 1, 0);
+    }
+    setBCoeffs(amrlev, amrex::GetArrOfConstPtrs(b));
+}
+
+// The cross terms need the edge ghost cells.  So a full FillBoundary
+// is done, and the edge ghost cells not filled by it are extrapolated
+// after the physical and coarse/fine boundaries are filled.
+void
+MLTensorOp::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode,
+                     const MLMGBndry* bndry, bool skip_fillboundary) const
+{
+    BL_PROFILE("MLTensorOp::applyBC()");
+
+    if (!skip_fillboundary) {
+        const Real comm_start_time = amrex::second();
+        in.FillBoundary(0, m_ncomp, m_geom[amrlev][mglev].periodicity());
+        m_comm_time += amrex::second() - comm_start_time;
+    }
+
+    MLABecLaplacian::applyBC(amrlev, mglev, in, bc_mode, bndry, true);
+
+    const iMultiFab& mask = m_edge_mask[amrlev][mglev];
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(in, MFItInfo().SetDynamic(true)); mfi.isValid(); ++mfi)
+    {
+        const Box& vbx = mfi.validbox();
+        amrex_mltensor_fill_edges(BL_TO_FORTRAN_BOX(vbx),
+                                  BL_TO_FORTRAN_ANYD(in[mfi]), m_ncomp,
+                                  BL_TO_FORTRAN_ANYD(mask[mfi]));
+    }
+}
+
+void
+MLTensorOp::crossFlux (int amrlev, int mglev, const MFIter& mfi, const Box& bx,
+                       const std::array<FArrayBox*,AMREX_SPACEDIM>& flux,
+                       const FArrayBox& sol, int face_only) const
+{
+    // eta is the b coefficient of any component other than the one normal to the face.
+    AMREX_D_TERM(const FArrayBox& ex = m_b_coeffs[amrlev][mglev][0][mfi];,
+                 const FArrayBox& ey = m_b_coeffs[amrlev][mglev][1][mfi];,
+                 const FArrayBox& ez = m_b_coeffs[amrlev][mglev][2][mfi];);
+    AMREX_D_TERM(const int ecx = 1 % AMREX_SPACEDIM;,
+                 const int ecy = 2 % AMREX_SPACEDIM;,
+                 const int ecz = 0;);
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+
+    amrex_mltensor_cross_flux(BL_TO_FORTRAN_BOX(bx),
+                              AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*flux[0]),
+                                           BL_TO_FORTRAN_ANYD(*flux[1]),
+                                           BL_TO_FORTRAN_ANYD(*flux[2])),
+                              BL_TO_FORTRAN_ANYD(sol),
+                              AMREX_D_DECL(BL_TO_FORTRAN_N_ANYD(ex,ecx),
+                                           BL_TO_FORTRAN_N_ANYD(ey,ecy),
+                                           BL_TO_FORTRAN_N_ANYD(ez,ecz)),
+                              dxinv, getBScalar(), face_only);
+}
+
+void
+MLTensorOp::crossDivergence (int amrlev, int mglev, const MFIter& mfi, const Box& bx,
+                             FArrayBox& divfab, const FArrayBox& sol,
+                             std::array<FArrayBox,AMREX_SPACEDIM>& flux) const
+{
+    AMREX_D_TERM(flux[0].resize(amrex::surroundingNodes(bx,0),m_ncomp);,
+                 flux[1].resize(amrex::surroundingNodes(bx,1),m_ncomp);,
+                 flux[2].resize(amrex::surroundingNodes(bx,2),m_ncomp););
+    divfab.resize(bx,m_ncomp);
+
+    crossFlux(amrlev, mglev, mfi, bx,
+              {AMREX_D_DECL(&flux[0],&flux[1],&flux[2])}, sol, 0);
+
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+    amrex_mltensor_cross_divergence(BL_TO_FORTRAN_BOX(bx),
+                                    BL_TO_FORTRAN_ANYD(divfab),
+                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD(flux[0]),
+                                                 BL_TO_FORTRAN_ANYD(flux[1]),
+                                                 BL_TO_FORTRAN_ANYD(flux[2])),
+                                    dxinv);
+}
+
+void
+MLTensorOp::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) const
+{
+    BL_PROFILE("MLTensorOp::Fapply()");
+
+    MLABecLaplacian::Fapply(amrlev, mglev, out, in);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        FArrayBox divfab;
+        std::array<FArrayBox,AMREX_SPACEDIM> flux;
+        for (MFIter mfi(out, true); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            crossDivergence(amrlev, mglev, mfi, bx, divfab, in[mfi], flux);
+            out[mfi].plus(divfab, bx, bx, 0, 0, m_ncomp);
+        }
+    }
+}
+
+// The cross terms are lagged, i.e., they are computed with the
+// solution before each red or black sweep and moved to the rhs.
+void
+MLTensorOp::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, int redblack) const
+{
+    BL_PROFILE("MLTensorOp::Fsmooth()");
+
+    MultiFab& rhs_cross = m_rhs_cross[amrlev][mglev];
+    AMREX_ASSERT(rhs_cross.boxArray() == rhs.boxArray());
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        FArrayBox divfab;
+        std::array<FArrayBox,AMREX_SPACEDIM> flux;
+        for (MFIter mfi(rhs_cross, true); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            crossDivergence(amrlev, mglev, mfi, bx, divfab, sol[mfi], flux);
+            FArrayBox& fab = rhs_cross[mfi];
+            fab.copy(rhs[mfi], bx, 0, bx, 0, m_ncomp);
+            fab.minus(divfab, bx, bx, 0, 0, m_ncomp);
+        }
+    }
+
+    MLABecLaplacian::Fsmooth(amrlev, mglev, sol, rhs_cross, redblack);
+}
+
+void
+MLTensorOp::FFlux (int amrlev, const MFIter& mfi,
+                   const std::array<FArrayBox*,AMREX_SPACEDIM>& flux,
+                   const FArrayBox& sol, const int face_only) const
+{
+    BL_PROFILE("MLTensorOp::FFlux()");
+
+    MLABecLaplacian::FFlux(amrlev, mfi, flux, sol, face_only);
+
+    const int mglev = 0;
+    const Box& box = mfi.tilebox();
+
+    std::array<FArrayBox,AMREX_SPACEDIM> cflux;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        cflux[idim].resize(amrex::surroundingNodes(box,idim),m_ncomp);
+        cflux[idim].setVal(0.0);
+    }
+
+    crossFlux(amrlev, mglev, mfi, box,
+              {AMREX_D_DECL(&cflux[0],&cflux[1],&cflux[2])}, sol, face_only);
+
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        const Box& nbx = amrex::surroundingNodes(box,idim);
+        flux[idim]->plus(cflux[idim], nbx, nbx, 0, 0, m_ncomp);
+    }
+}
+
+}
@@ -0,0 +1,225 @@
+#include <fstream>
+#include <sstream>
+
+#include <AMReX_ParticleColumnarIO.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_NFiles.H>
+#include <AMReX_Utility.H>
+#include <AMReX_VectorIO.H>
+
+using namespace amrex;
+
+ParticleColumnarHeader::ParticleColumnarHeader (const std::string& a_dir)
+{
+    read(a_dir);
+}
+
+const std::string&
+ParticleColumnarHeader::Version ()
+{
+    static const std::string version("Version_Columnar_One");
+    return version;
+}
+
+const std::string&
+ParticleColumnarHeader::DataPrefix ()
+{
+    static const std::string data("DATA_");
+    return data;
+}
+
+void
+ParticleColumnarHeader::read (const std::string& a_dir)
+{
+    dir = a_dir;
+    if (!dir.empty() && dir[dir.size()-1] != '/') {
+        dir += '/';
+    }
+
+    const std::string HdrFileName = dir + "Header";
+
+    Vector<char> fileCharPtr;
+    ParallelDescriptor::ReadAndBcastFile(HdrFileName, fileCharPtr);
+    std::string fileCharPtrString(fileCharPtr.dataPtr());
+    std::istringstream HdrFile(fileCharPtrString, std::istringstream::in);
+
+    HdrFile >> version;
+    if (version.find(Version()) != 0) {
+        amrex::Abort("ParticleColumnarHeader::read(): unknown version string: " + version);
+    }
+    is_single = (version.find("_single") != std::string::npos);
+
+    HdrFile >> dim;
+
+    int nr, ni;
+    HdrFile >> nr;
+    real_names.resize(nr);
+    for (int i = 0; i < nr; ++i) {
+        HdrFile >> real_names[i];
+    }
+    HdrFile >> ni;
+    int_names.resize(ni);
+    for (int i = 0; i < ni; ++i) {
+        HdrFile >> int_names[i];
+    }
+
+    HdrFile >> rd;
+    HdrFile >> id;
+
+    HdrFile >> nparticles;
+    HdrFile >> maxnextid;
+    HdrFile >> finest_level;
+
+    grids.resize(finest_level+1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        int ngrids;
+        HdrFile >> ngrids;
+        grids[lev].resize(ngrids);
+        for (auto& g : grids[lev]) {
+            HdrFile >> g.file >> g.count >> g.offset;
+        }
+    }
+
+    if (!HdrFile.good()) {
+        amrex::Abort("ParticleColumnarHeader::read(): problem reading " + HdrFileName);
+    }
+}
+
+std::string
+ParticleColumnarHeader::DataFileName (int lev, int file) const
+{
+    return NFilesIter::FileName(file, amrex::Concatenate(dir + "Level_", lev, 1) + '/' + DataPrefix());
+}
+
+int
+ParticleColumnarHeader::realComp (const std::string& name) const
+{
+    for (int i = 0, N = real_names.size(); i < N; ++i) {
+        if (real_names[i] == name) return i;
+    }
+    return -1;
+}
+
+int
+ParticleColumnarHeader::intComp (const std::string& name) const
+{
+    for (int i = 0, N = int_names.size(); i < N; ++i) {
+        if (int_names[i] == name) return i;
+    }
+    return -1;
+}
+
+long
+ParticleColumnarHeader::seekIntComp (std::istream& is, int lev, int grid, int comp) const
+{
+    BL_ASSERT(comp >= 0 && comp < numIntComps());
+    const GridEntry& g = grids[lev][grid];
+    const long isize = id.numBytes();
+    is.seekg(g.offset + comp*g.count*isize, std::ios::beg);
+    return g.count;
+}
+
+long
+ParticleColumnarHeader::seekRealComp (std::istream& is, int lev, int grid, int comp) const
+{
+    BL_ASSERT(comp >= 0 && comp < numRealComps());
+    const GridEntry& g = grids[lev][grid];
+    const long isize = id.numBytes();
+    const long rsize = rd.numBytes();
+    is.seekg(g.offset + numIntComps()*g.count*isize + comp*g.count*rsize, std::ios::beg);
+    return g.count;
+}
+
+void
+ParticleColumnarHeader::ReadRealComp (std::istream& is, int lev, int grid, int comp, float* data) const
+{
+    const long n = seekRealComp(is, lev, grid, comp);
+    if (n > 0) readFloatData(data, n, is, rd);
+}
+
+void
+ParticleColumnarHeader::ReadRealComp (std::istream& is, int lev, int grid, int comp, double* data) const
+{
+    const long n = seekRealComp(is, lev, grid, comp);
+    if (n > 0) readDoubleData(data, n, is, rd);
+}
+
+void
+ParticleColumnarHeader::ReadIntComp (std::istream& is, int lev, int grid, int comp, int* data) const
+{
+    const long n = seekIntComp(is, lev, grid, comp);
+    if (n > 0) readIntData(data, n, is, id);
+}
+
+void
+ParticleColumnarHeader::ReadRealComps (std::istream& is, int lev, int grid, float* data) const
+{
+    const long n = seekRealComp(is, lev, grid, 0);
+    if (n > 0) readFloatData(data, n*numRealComps(), is, rd);
+}
+
+void
+ParticleColumnarHeader::ReadRealComps (std::istream& is, int lev, int grid, double* data) const
+{
+    const long n = seekRealComp(is, lev, grid, 0);
+    if (n > 0) readDoubleData(data, n*numRealComps(), is, rd);
+}
+
+void
+ParticleColumnarHeader::ReadIntComps (std::istream& is, int lev, int grid, int* data) const
+{
+    const long n = seekIntComp(is, lev, grid, 0);
+    if (n > 0) readIntData(data, n*numIntComps(), is, id);
+}
+
+void
+ParticleColumnarHeader::ReadRealComp (int lev, int comp, Vector<Real>& data) const
+{
+    long n = 0;
+    for (const auto& g : grids[lev]) n += g.count;
+    data.resize(n);
+
+    std::ifstream ifs;
+    int file = -1;
+    long offset = 0;
+    const int ngrids = grids[lev].size();
+    for (int grid = 0; grid < ngrids; ++grid) {
+        const GridEntry& g = grids[lev][grid];
+        if (g.count == 0) continue;
+        if (g.file != file) {
+            if (ifs.is_open()) ifs.close();
+            file = g.file;
+            const std::string name = DataFileName(lev, file);
+            ifs.open(name.c_str(), std::ios::in|std::ios::binary);
+            if (!ifs.good()) amrex::FileOpenFailed(name);
+        }
+        ReadRealComp(ifs, lev, grid, comp, data.dataPtr() + offset);
+        offset += g.count;
+    }
+}
+
+void
+ParticleColumnarHeader::ReadIntComp (int lev, int comp, Vector<int>& data) const
+{
+    long n = 0;
+    for (const auto& g : grids[lev]) n += g.count;
+    data.resize(n);
+
+    std::ifstream ifs;
+    int file = -1;
+    long offset = 0;
+    const int ngrids = grids[lev].size();
+    for (int grid = 0; grid < ngrids; ++grid) {
+        const GridEntry& g = grids[lev][grid];
+        if (g.count == 0) continue;
+        if (g.file != file) {
+            if (ifs.is_open()) ifs.close();
+            file = g.file;
+            const std::string name = DataFileName(lev, file);
+            ifs.open(name.c_str(), std::ios::in|std::ios::binary);
+            if (!ifs.good()) amrex::FileOpenFailed(name);
+        }
+        ReadIntComp(ifs, lev, grid, comp, data.dataPtr() + offset);
+        offset += g.count;
+    }
+}
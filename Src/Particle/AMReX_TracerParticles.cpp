@@ -3,6 +3,58 @@
 
 namespace amrex {
 
+namespace {
+
+//
+// One pass of the midpoint method on the np particles of pd, which may be
+// an AoSParticleData or a SoAParticleData.  The velocities are all
+// interpolated at the positions at the start of the pass, then the
+// positions are updated.
+//
+template <class PD>
+void
+advect_tile_with_umac (const PD& pd, int np, const FArrayBox* const* umac,
+                       const Real* plo, const Real* dxi, Real dt, int ipass)
+{
+    Vector<Real> vel(AMREX_SPACEDIM*np);
+    for (int d = 0; d < AMREX_SPACEDIM; d++)
+    {
+        Real* v = vel.dataPtr() + d*np;
+        ParticleGather<1,1>(pd, np, *umac[d], 0, plo, dxi,
+                            [=] (int i, const Real* val) { v[i] = val[0]; });
+    }
+
+    for (int i = 0; i < np; i++)
+    {
+        if (pd.id(i) <= 0) continue;
+
+        for (int d = 0; d < AMREX_SPACEDIM; d++)
+        {
+            const Real v = vel[d*np+i];
+
+            if (ipass == 0)
+            {
+                //
+                // Save old position and the vel & predict location at dt/2.
+                //
+                pd.rdata(i,d) = pd.pos(i,d);
+                pd.pos(i,d) += 0.5*dt*v;
+            }
+            else
+            {
+                //
+                // Update to final time using the orig position and the vel at dt/2.
+                //
+                pd.pos(i,d) = pd.rdata(i,d) + dt*v;
+                // Save the velocity for use in Timestamp().
+                pd.rdata(i,d) = v;
+            }
+        }
+    }
+}
+
+}
+
 //
 // Uses midpoint method to advance particles using umac.
 //
@@ -23,7 +75,7 @@ TracerParticleContainer::AdvectWithUmac (MultiFab* umac, int lev, Real dt)
 
     const Real      strttime = ParallelDescriptor::second();
     const Geometry& geom     = m_gdb->Geom(lev);
-    const Real*     dx       = geom.CellSize();
+    const Real*     dxi      = geom.InvCellSize();
     const Real*     plo      = geom.ProbLo();
 
     Vector<std::unique_ptr<MultiFab> > raii_umac(AMREX_SPACEDIM);
@@ -50,73 +102,34 @@ TracerParticleContainer::AdvectWithUmac (MultiFab* umac, int lev, Real dt)
         }
     }
 
+    auto& pmap = GetParticles(lev);
+    Vector<ParticleTileType*> tiles;
+    Vector<int> grids;
+    for (auto& kv : pmap) {
+        tiles.push_back(&kv.second);
+        grids.push_back(kv.first.first);
+    }
+
     for (int ipass = 0; ipass < 2; ipass++)
     {
-        auto& pmap = GetParticles(lev);
-	for (auto& kv : pmap) {
-	  int grid = kv.first.first;
-	  auto& pbox = kv.second.GetArrayOfStructs();
-	  const int n = pbox.size();
-
-	  FArrayBox* fab[AMREX_SPACEDIM] = { AMREX_D_DECL(&((*umac_pointer[0])[grid]),
-						 &((*umac_pointer[1])[grid]),
-						 &((*umac_pointer[2])[grid])) };
-
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(dynamic)
 #endif
-            for (int i = 0; i < n; i++)
-            {
-                ParticleType& p = pbox[i];
-
-                if (p.m_idata.id <= 0) continue;
-
-                const IntVect& cc_cell = Index(p, lev);
-
-                const Real len[AMREX_SPACEDIM] = { AMREX_D_DECL((p.m_rdata.pos[0]-plo[0])/dx[0] + Real(0.5),
-                                                       (p.m_rdata.pos[1]-plo[1])/dx[1] + Real(0.5),
-                                                       (p.m_rdata.pos[2]-plo[2])/dx[2] + Real(0.5)) };
-
-                const IntVect cell(AMREX_D_DECL(floor(len[0]), floor(len[1]), floor(len[2])));
-
-                const Real frac[AMREX_SPACEDIM] = { AMREX_D_DECL(len[0]-cell[0], len[1]-cell[1], len[2]-cell[2]) };
-
-                for (int d = 0; d < AMREX_SPACEDIM; d++)
-                {
-                    IntVect ecell = cell;
-
-                    ecell[d] = cc_cell[d] + 1;
-
-                    Real efrac[AMREX_SPACEDIM] = { AMREX_D_DECL(frac[0], frac[1], frac[2]) };
-
-                    efrac[d] = (p.m_rdata.pos[d]-plo[d])/dx[d] - cc_cell[d];
-
-                    for (int j = 0; j < AMREX_SPACEDIM; j++)
-                    {
-                        if (efrac[j] > 1) efrac[j] = 1;
-                        if (efrac[j] < 0) efrac[j] = 0;
-                    }
-
-                    Real vel = ParticleType::InterpDoit(*fab[d], ecell, efrac, 0);
-
-                    if (ipass == 0)
-                    {
-                        //
-                        // Save old position and the vel & predict location at dt/2.
-                        //
-                        p.m_rdata.arr[AMREX_SPACEDIM+d] = p.m_rdata.pos[d];
-                        p.m_rdata.pos[d] += 0.5*dt*vel;
-                    }
-                    else
-                    {
-		        //
-                        // Update to final time using the orig position and the vel at dt/2.
-                        //
-		        p.m_rdata.pos[d]  = p.m_rdata.arr[AMREX_SPACEDIM+d] + dt*vel;
-                        // Save the velocity for use in Timestamp().
-			p.m_rdata.arr[AMREX_SPACEDIM+d] = vel;
-                    }
-                }
+        for (int t = 0; t < tiles.size(); ++t)
+        {
+            ParticleTileType* ptile = tiles[t];
+            const FArrayBox* u[AMREX_SPACEDIM] = {AMREX_D_DECL(&(*umac_pointer[0])[grids[t]],
+                                                               &(*umac_pointer[1])[grids[t]],
+                                                               &(*umac_pointer[2])[grids[t]])};
+            if (ptile->isSoA()) {
+                const int n = ptile->numParticles();
+                SoAParticleData<ParticleTileType::StructSoA> pd(ptile->GetSoAParticles());
+                advect_tile_with_umac(pd, n, u, plo, dxi, dt, ipass);
+            } else {
+                auto& pbox = ptile->GetArrayOfStructs();
+                const int n = pbox.size();
+                AoSParticleData<ParticleType> pd{pbox().data()};
+                advect_tile_with_umac(pd, n, u, plo, dxi, dt, ipass);
             }
         }
     }
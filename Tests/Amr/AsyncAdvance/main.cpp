@@ -0,0 +1,290 @@
+// Test of AmrLevel::post_advance with amr.async_advance.
+//
+// Every level adds one to its integer-valued state in advance, in a serial
+// MFIter loop.  Its post_advance sums the new data of the local boxes in an
+// OpenMP region and in a serial MFIter loop, which with amr.async_advance
+// run concurrently with the finer levels.  The serial loops must visit all
+// the local boxes, also when they run inside the team of async_advance.
+// post_timestep checks that post_advance was called once per advance and
+// that its sum is the sum of the data the level has before it is
+// averaged down, i.e., that the finer levels did not touch this level
+// while post_advance was running.  The post_advance calls that run
+// concurrently with the finer levels must have been given one thread; their
+// number is printed.
+
+#include <atomic>
+#include <algorithm>
+#include <cmath>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Amr.H>
+#include <AMReX_AmrLevel.H>
+#include <AMReX_LevelBld.H>
+#include <AMReX_MultiFabUtil.H>
+
+using namespace amrex;
+
+namespace {
+
+std::atomic<long> num_async_post(0);
+std::atomic<int>  max_post_threads(0);
+std::atomic<bool> failed(false);
+
+extern "C"
+{
+    void null_fill (Real*, ARLIM_P(lo), ARLIM_P(hi), const int*, const int*,
+                    const Real*, const Real*, const Real*, const int*)
+    {}
+
+    void amrex_probinit (const int*, const int*, const int*, const Real*, const Real*)
+    {}
+}
+
+Real local_sum (const MultiFab& mf)
+{
+    Real s = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel reduction(+:s)
+#endif
+    for (MFIter mfi(mf, true); mfi.isValid(); ++mfi) {
+        s += mf[mfi].sum(mfi.tilebox(), 0);
+    }
+    return s;
+}
+
+// Without an OpenMP region of its own, so it must get all the local boxes.
+Real serial_sum (const MultiFab& mf)
+{
+    Real s = 0.0;
+    int nboxes = 0;
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        s += mf[mfi].sum(mfi.validbox(), 0);
+        ++nboxes;
+    }
+    if (nboxes != mf.local_size()) failed = true;
+    return s;
+}
+
+}
+
+class TestLevel
+    :
+    public AmrLevel
+{
+public:
+
+    TestLevel () {}
+
+    TestLevel (Amr& papa, int lev, const Geometry& level_geom, const BoxArray& ba,
+               const DistributionMapping& dm, Real time)
+        :
+        AmrLevel(papa, lev, level_geom, ba, dm, time) {}
+
+    static void variableSetUp ()
+    {
+        desc_lst.addDescriptor(0, IndexType::TheCellType(), StateDescriptor::Point,
+                               0, 1, &pc_interp);
+        BCRec bc;
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            bc.setLo(d, BCType::int_dir);
+            bc.setHi(d, BCType::int_dir);
+        }
+        desc_lst.setComponent(0, 0, "phi", bc, StateDescriptor::BndryFunc(null_fill));
+    }
+
+    static void variableCleanUp ()
+    {
+        desc_lst.clear();
+    }
+
+    virtual void computeInitialDt (int finest_level, int, Vector<int>& n_cycle,
+                                   const Vector<IntVect>&, Vector<Real>& dt_level,
+                                   Real) override
+    {
+        if (level > 0) return;
+        dt_level[0] = 0.01;
+        for (int lev = 1; lev <= finest_level; ++lev) {
+            dt_level[lev] = dt_level[lev-1] / n_cycle[lev];
+        }
+    }
+
+    virtual void computeNewDt (int finest_level, int sub_cycle, Vector<int>& n_cycle,
+                               const Vector<IntVect>& ref_ratio, Vector<Real>& dt_min,
+                               Vector<Real>& dt_level, Real stop_time, int) override
+    {
+        computeInitialDt(finest_level, sub_cycle, n_cycle, ref_ratio, dt_level, stop_time);
+        if (level == 0) {
+            for (int lev = 0; lev <= finest_level; ++lev) dt_min[lev] = dt_level[lev];
+        }
+    }
+
+    virtual Real advance (Real, Real dt, int, int) override
+    {
+        state[0].allocOldData();
+        state[0].swapTimeLevels(dt);
+        MultiFab& S_new = get_new_data(0);
+        MultiFab::Copy(S_new, get_old_data(0), 0, 0, 1, 0);
+        int nboxes = 0;
+        for (MFIter mfi(S_new); mfi.isValid(); ++mfi) {
+            S_new[mfi].plus(1.0, mfi.validbox(), 0, 1);
+            ++nboxes;
+        }
+        if (nboxes != S_new.local_size()) failed = true;
+        ++m_advance_count;
+        return dt;
+    }
+
+    virtual void post_advance (int) override
+    {
+        m_post_sum = local_sum(get_new_data(0));
+        if (serial_sum(get_new_data(0)) != m_post_sum) failed = true;
+        ++m_post_count;
+#ifdef _OPENMP
+        if (level < parent->finestLevel() && omp_get_level() > 0)
+        {
+            ++num_async_post;
+            int nt = max_post_threads.load();
+            while (nt < omp_get_max_threads() &&
+                   !max_post_threads.compare_exchange_weak(nt, omp_get_max_threads())) {}
+        }
+#endif
+    }
+
+    virtual void post_timestep (int) override
+    {
+        if (m_post_count != m_advance_count ||
+            m_post_sum != local_sum(get_new_data(0)))
+        {
+            failed = true;
+        }
+        if (level < parent->finestLevel()) {
+            TestLevel& fine = static_cast<TestLevel&>(parent->getLevel(level+1));
+            amrex::average_down(fine.get_new_data(0), get_new_data(0), 0, 1,
+                                parent->refRatio(level));
+        }
+    }
+
+    virtual void post_regrid (int, int) override {}
+
+    virtual void post_init (Real) override
+    {
+        if (level > 0) return;
+        for (int lev = parent->finestLevel()-1; lev >= 0; --lev) {
+            TestLevel& fine = static_cast<TestLevel&>(parent->getLevel(lev+1));
+            TestLevel& crse = static_cast<TestLevel&>(parent->getLevel(lev));
+            amrex::average_down(fine.get_new_data(0), crse.get_new_data(0), 0, 1,
+                                parent->refRatio(lev));
+        }
+    }
+
+    virtual void initData () override
+    {
+        MultiFab& S_new = get_new_data(0);
+        for (MFIter mfi(S_new); mfi.isValid(); ++mfi) {
+            FArrayBox& fab = S_new[mfi];
+            const Box& bx = mfi.validbox();
+            for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv)) {
+                fab(iv) = (AMREX_D_TERM(iv[0], + iv[1], + iv[2])) % 7;
+            }
+        }
+    }
+
+    virtual void init (AmrLevel& old) override
+    {
+        const Real dt_new = parent->dtLevel(level);
+        const Real cur_time = old.get_state_data(0).curTime();
+        const Real prev_time = old.get_state_data(0).prevTime();
+        setTimeLevel(cur_time, cur_time-prev_time, dt_new);
+        FillPatch(old, get_new_data(0), 0, cur_time, 0, 0, 1);
+    }
+
+    virtual void init () override
+    {
+        const Real dt = parent->dtLevel(level);
+        const Real cur_time = getLevel(level-1).get_state_data(0).curTime();
+        const Real prev_time = getLevel(level-1).get_state_data(0).prevTime();
+        setTimeLevel(cur_time, (cur_time-prev_time)/parent->MaxRefRatio(level-1), dt);
+        FillCoarsePatch(get_new_data(0), 0, cur_time, 0, 0, 1);
+    }
+
+    virtual void errorEst (TagBoxArray& tags, int, int tagval, Real time, int, int) override
+    {
+        //
+        // A slab that moves with time.
+        //
+        const Real* dx  = geom.CellSize();
+        const Real* plo = geom.ProbLo();
+        const Real xc = 0.3 + 2.0*time;
+        for (MFIter mfi(tags); mfi.isValid(); ++mfi) {
+            TagBox& tb = tags[mfi];
+            const Box& bx = mfi.validbox();
+            for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv)) {
+                const Real x = plo[0] + (iv[0]+0.5)*dx[0];
+                if (std::abs(x - xc) < 0.1 + 0.05*level) tb(iv) = tagval;
+            }
+        }
+    }
+
+private:
+
+    TestLevel& getLevel (int lev) { return static_cast<TestLevel&>(parent->getLevel(lev)); }
+
+    long m_advance_count = 0;
+    long m_post_count    = 0;
+    Real m_post_sum      = 0.0;
+};
+
+class TestBld
+    :
+    public LevelBld
+{
+    virtual void variableSetUp () override { TestLevel::variableSetUp(); }
+    virtual void variableCleanUp () override { TestLevel::variableCleanUp(); }
+    virtual AmrLevel* operator() () override { return new TestLevel; }
+    virtual AmrLevel* operator() (Amr& papa, int lev, const Geometry& level_geom,
+                                  const BoxArray& ba, const DistributionMapping& dm,
+                                  Real time) override
+    {
+        return new TestLevel(papa, lev, level_geom, ba, dm, time);
+    }
+};
+
+TestBld test_bld;
+
+LevelBld* getLevelBld ()
+{
+    return &test_bld;
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int max_step = 8;
+        {
+            ParmParse pp;
+            pp.query("max_step", max_step);
+        }
+
+        Amr amr;
+        amr.init(0.0, 1.e10);
+
+        while (amr.levelSteps(0) < max_step) {
+            amr.coarseTimeStep(1.e10);
+        }
+
+        bool fail = failed.load() || max_post_threads.load() > 1;
+        ParallelDescriptor::ReduceBoolOr(fail);
+        long nasync = num_async_post.load();
+        ParallelDescriptor::ReduceLongMax(nasync);
+        amrex::Print() << "Finest level: " << amr.finestLevel()
+                       << ", concurrent post_advance calls: " << nasync << "\n";
+        amrex::Print() << (fail ? "FAIL" : "pass") << "\n";
+    }
+    amrex::Finalize();
+}
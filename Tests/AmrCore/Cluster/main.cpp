@@ -0,0 +1,134 @@
+// Test and timings of the grid generation from tagged cells.
+//
+// The cells in a spherical shell are tagged and buffered, and grids are
+// built from the tags by gathering them on all the processes, as in
+// TagBoxArray::collate, and by clustering them on each process with
+// TagBoxArray::cluster.  The distributed grids are checked to be disjoint,
+// to cover all the tagged cells and to be the same on all the processes.
+// The number of boxes, their efficiency and the times are printed.
+
+#include <cmath>
+#include <iostream>
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_BoxDomain.H>
+#include <AMReX_Cluster.H>
+#include <AMReX_TagBox.H>
+
+using namespace amrex;
+
+namespace {
+
+void report (const std::string& name, const BoxList& bl, long ntags, Real t)
+{
+    long ncells = 0;
+    for (const Box& bx : bl) ncells += bx.numPts();
+    ParallelDescriptor::ReduceRealMax(t);
+    amrex::Print() << "  " << name << ": " << bl.size() << " boxes, efficiency "
+                   << Real(ntags)/Real(ncells) << ", time " << t << " s\n";
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 128;
+        int max_grid_size = 32;
+        Real radius = 0.3;
+        Real thickness = 0.02;
+        int n_error_buf = 2;
+        Real grid_eff = 0.7;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("radius", radius);
+            pp.query("thickness", thickness);
+            pp.query("n_error_buf", n_error_buf);
+            pp.query("grid_eff", grid_eff);
+        }
+
+        const Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+                         IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dmap(ba);
+
+        TagBoxArray tags(ba, dmap, n_error_buf);
+        tags.setVal(TagBox::CLEAR);
+        for (MFIter mfi(tags); mfi.isValid(); ++mfi)
+        {
+            TagBox& tagfab = tags[mfi];
+            const Box& bx = mfi.validbox();
+            for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv))
+            {
+                Real r2 = 0.0;
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    const Real x = (iv[d] + 0.5)/n_cell - 0.5;
+                    r2 += x*x;
+                }
+                if (std::abs(std::sqrt(r2) - radius) < thickness) {
+                    tagfab(iv) = TagBox::SET;
+                }
+            }
+        }
+        tags.buffer(n_error_buf);
+
+        BoxDomain bd;
+        bd.add(domain);
+
+        //
+        // All the tags gathered on all the processes.
+        //
+        Vector<IntVect> tagvec;
+        BoxList bl_gather;
+        Real t = ParallelDescriptor::second();
+        tags.collate(tagvec);
+        const long ntags = tagvec.size();
+        {
+            ClusterList clist(&tagvec[0], tagvec.size());
+            clist.chop(grid_eff);
+            clist.intersect(bd);
+            clist.boxList(bl_gather);
+        }
+        t = ParallelDescriptor::second() - t;
+
+        amrex::Print() << "Tags: " << ntags << ", processes: " << ParallelDescriptor::NProcs() << "\n";
+        report("gathered tags   ", bl_gather, ntags, t);
+
+        //
+        // The tags clustered on each process.
+        //
+        BoxList bl;
+        t = ParallelDescriptor::second();
+        const long ntags_local = tags.cluster(bl, grid_eff, bd);
+        t = ParallelDescriptor::second() - t;
+
+        report("distributed     ", bl, ntags, t);
+
+        if (ntags_local < ntags || !bl.isDisjoint()) {
+            amrex::Abort("TagBoxArray::cluster: wrong number of tags or boxes not disjoint");
+        }
+
+        const BoxArray cluster_ba(bl);
+        for (const IntVect& iv : tagvec) {
+            if (domain.contains(iv) && !cluster_ba.contains(iv)) {
+                amrex::Abort("TagBoxArray::cluster: tagged cell not covered");
+            }
+        }
+
+        long nboxes_min = bl.size(), nboxes_max = bl.size();
+        long ncells_min = cluster_ba.numPts(), ncells_max = cluster_ba.numPts();
+        ParallelDescriptor::ReduceLongMin(nboxes_min);
+        ParallelDescriptor::ReduceLongMax(nboxes_max);
+        ParallelDescriptor::ReduceLongMin(ncells_min);
+        ParallelDescriptor::ReduceLongMax(ncells_max);
+        if (nboxes_min != nboxes_max || ncells_min != ncells_max) {
+            amrex::Abort("TagBoxArray::cluster: boxes differ between processes");
+        }
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,164 @@
+// Test and timings of the reuse of the coarse patches of FillPatchTwoLevels.
+//
+// The ghost cells of a fine level are filled from a coarse level with
+// data at two times, at the times of the subcycles of the fine level,
+// copying the coarse data again in each call and with the coarse data
+// declared unchanged with FillPatchBeginReuse during the subcycles of each
+// coarse step.  The coarse data are changed between the coarse steps.
+// The results must be the same, and the kept coarse patches must be freed
+// by FillPatchEndReuse; the times of both are printed.
+
+#include <cmath>
+#include <iostream>
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Geometry.H>
+#include <AMReX_FillPatchUtil.H>
+#include <AMReX_Interpolater.H>
+
+using namespace amrex;
+
+namespace {
+
+// The domain is periodic, so there is nothing to fill.
+class NoPhysBC
+    : public PhysBCFunctBase
+{
+public:
+    virtual void FillBoundary (MultiFab& mf, int dcomp, int ncomp, Real time) override {}
+};
+
+void init (MultiFab& mf, const Geometry& geom, Real t)
+{
+    const Real* dx = geom.CellSize();
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        FArrayBox& fab = mf[mfi];
+        const Box& bx = mfi.validbox();
+        for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv))
+        {
+            Real v = t;
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                v += std::sin(2.0*M_PI*(iv[d]+0.5)*dx[d] + d);
+            }
+            for (int n = 0; n < mf.nComp(); ++n) {
+                fab(iv,n) = (n+1)*v;
+            }
+        }
+    }
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 32;
+        int ratio = 2;
+        int ncycle = 2;
+        int nghost = 3;
+        int nsteps = 5;
+        int ncomp = 2;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("ratio", ratio);
+            pp.query("ncycle", ncycle);
+            pp.query("nghost", nghost);
+            pp.query("nsteps", nsteps);
+            pp.query("ncomp", ncomp);
+        }
+
+        const Box cdomain(IntVect::TheZeroVector(), IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+        RealBox rb({AMREX_D_DECL(0.0,0.0,0.0)}, {AMREX_D_DECL(1.0,1.0,1.0)});
+        int is_per[] = {AMREX_D_DECL(1,1,1)};
+        const Geometry cgeom(cdomain, &rb, 0, is_per);
+        const IntVect rr(AMREX_D_DECL(ratio,ratio,ratio));
+        const Geometry fgeom(amrex::refine(cdomain, rr), &rb, 0, is_per);
+
+        BoxArray cba(cdomain);
+        cba.maxSize(max_grid_size);
+        DistributionMapping cdm(cba);
+
+        BoxArray fba(amrex::refine(Box(IntVect(AMREX_D_DECL(n_cell/4,n_cell/4,n_cell/4)),
+                                       IntVect(AMREX_D_DECL(3*n_cell/4-1,3*n_cell/4-1,3*n_cell/4-1))),
+                                   rr));
+        fba.maxSize(max_grid_size);
+        DistributionMapping fdm(fba);
+
+        MultiFab crse_old(cba, cdm, ncomp, 0);
+        MultiFab crse_new(cba, cdm, ncomp, 0);
+        MultiFab fine(fba, fdm, ncomp, 0);
+        Vector<std::unique_ptr<MultiFab> > mf_copy(ncycle);
+        for (auto& mf : mf_copy) mf.reset(new MultiFab(fba, fdm, ncomp, nghost));
+        MultiFab mf_reuse(fba, fdm, ncomp, nghost);
+
+        NoPhysBC physbc;
+        Vector<BCRec> bcs(ncomp, BCRec(AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::int_dir),
+                                       AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::int_dir)));
+
+        Real t_copy = 0.0, t_reuse = 0.0;
+        const Real dt = 1.0;
+
+        for (int step = 0; step < nsteps; ++step)
+        {
+            const Real time = step*dt;
+            init(crse_old, cgeom, time);
+            init(crse_new, cgeom, time+dt);
+
+            const Vector<MultiFab*> cmf{&crse_old, &crse_new};
+            const Vector<Real> ct{time, time+dt};
+            const Vector<const MultiFab*> frozen{&crse_old, &crse_new};
+
+            for (int i = 0; i < ncycle; ++i)
+            {
+                const Real ftime = time + i*dt/ncycle;
+                init(fine, fgeom, ftime);
+                Real t = ParallelDescriptor::second();
+                FillPatchTwoLevels(*mf_copy[i], ftime, cmf, ct, {&fine}, {ftime},
+                                   0, 0, ncomp, cgeom, fgeom, physbc, physbc,
+                                   rr, &cell_cons_interp, bcs);
+                t_copy += ParallelDescriptor::second() - t;
+            }
+
+            FillPatchBeginReuse(frozen);
+            for (int i = 0; i < ncycle; ++i)
+            {
+                const Real ftime = time + i*dt/ncycle;
+                init(fine, fgeom, ftime);
+                Real t = ParallelDescriptor::second();
+                FillPatchTwoLevels(mf_reuse, ftime, cmf, ct, {&fine}, {ftime},
+                                   0, 0, ncomp, cgeom, fgeom, physbc, physbc,
+                                   rr, &cell_cons_interp, bcs);
+                t_reuse += ParallelDescriptor::second() - t;
+
+                MultiFab::Subtract(mf_reuse, *mf_copy[i], 0, 0, ncomp, nghost);
+                const Real diff = mf_reuse.norm0(0, nghost);
+                if (diff != 0.0) {
+                    amrex::Print() << "step " << step << ", subcycle " << i
+                                   << ": max difference " << diff << "\n";
+                    amrex::Abort("FillPatchTwoLevels: the reused coarse patches give different results");
+                }
+            }
+            FillPatchEndReuse(frozen);
+
+            for (const auto& kv : FabArrayBase::m_TheFillPatchCache) {
+                if (kv.second->m_crse_patch != nullptr || !kv.second->m_crse_data.empty()) {
+                    amrex::Abort("FillPatchEndReuse: the coarse patches are not freed");
+                }
+            }
+        }
+
+        ParallelDescriptor::ReduceRealMax(t_copy);
+        ParallelDescriptor::ReduceRealMax(t_reuse);
+
+        amrex::Print() << "Coarse steps: " << nsteps << ", subcycles: " << ncycle << "\n"
+                       << "  coarse data copied in each call: " << t_copy << " s\n"
+                       << "  coarse patches reused          : " << t_reuse << " s\n";
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,220 @@
+// Test and timings of the split-phase Reflux_nowait/Reflux_finish of
+// FluxRegister and YAFluxRegister.
+//
+// The registers between a periodic coarse level and a fine level made of
+// a block in the middle of the domain and a slab across the periodic
+// boundary are filled with the same coarse and fine fluxes, and the
+// coarse state is refluxed with Reflux and with Reflux_nowait followed by
+// Reflux_finish.  The results are checked to be identical.  The times of
+// Reflux followed by some work on the coarse level and of the same work
+// done between Reflux_nowait and Reflux_finish are printed.
+
+#include <cmath>
+#include <array>
+#include <memory>
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_FluxRegister.H>
+#include <AMReX_YAFluxRegister.H>
+
+using namespace amrex;
+
+namespace {
+
+void fill (MultiFab& mf, Real shift)
+{
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        FArrayBox& fab = mf[mfi];
+        const Box& bx = fab.box();
+        for (int n = 0; n < mf.nComp(); ++n) {
+            for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv)) {
+                Real x = shift + n;
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    x += (0.3 + 0.4*d) * iv[d];
+                }
+                fab(iv,n) = std::sin(x);
+            }
+        }
+    }
+}
+
+Real maxdiff (const MultiFab& a, const MultiFab& b)
+{
+    MultiFab diff(a.boxArray(), a.DistributionMap(), a.nComp(), 0);
+    MultiFab::Copy(diff, a, 0, 0, a.nComp(), 0);
+    MultiFab::Subtract(diff, b, 0, 0, a.nComp(), 0);
+    Real r = 0.0;
+    for (int n = 0; n < a.nComp(); ++n) {
+        r = std::max(r, diff.norm0(n));
+    }
+    return r;
+}
+
+// Work on the coarse level that does not touch the refluxed state.
+void work (MultiFab& mf, int nwork)
+{
+    for (int i = 0; i < nwork; ++i) {
+        mf.mult(0.5);
+        mf.plus(1.0, 0, mf.nComp());
+    }
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 16;
+        int ncomp = 4;
+        int nrepeat = 10;
+        int nwork = 20;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("ncomp", ncomp);
+            pp.query("nrepeat", nrepeat);
+            pp.query("nwork", nwork);
+        }
+
+        const IntVect ratio(AMREX_D_DECL(2,2,2));
+
+        const Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+                         IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+        RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+        std::array<int,AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(1,1,1)};
+        Geometry cgeom(domain, &rb, 0, is_periodic.data());
+        Geometry fgeom(amrex::refine(domain,ratio), &rb, 0, is_periodic.data());
+
+        BoxArray cba(domain);
+        cba.maxSize(max_grid_size);
+        DistributionMapping cdm(cba);
+
+        BoxList bl;
+        bl.push_back(Box(IntVect(AMREX_D_DECL(n_cell/4,n_cell/4,n_cell/4)),
+                         IntVect(AMREX_D_DECL(3*n_cell/4-1,3*n_cell/4-1,3*n_cell/4-1))));
+        bl.push_back(Box(IntVect(AMREX_D_DECL(0,n_cell/8,n_cell/8)),
+                         IntVect(AMREX_D_DECL(n_cell/8-1,n_cell/4-1,n_cell/4-1))));
+        bl.push_back(Box(IntVect(AMREX_D_DECL(7*n_cell/8,n_cell/8,n_cell/8)),
+                         IntVect(AMREX_D_DECL(n_cell-1,n_cell/4-1,n_cell/4-1))));
+        BoxArray fba(bl);
+        fba.refine(ratio);
+        fba.maxSize(max_grid_size);
+        DistributionMapping fdm(fba);
+
+        std::array<std::unique_ptr<MultiFab>,AMREX_SPACEDIM> cflux, fflux;
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            const IntVect& typ = IntVect::TheDimensionVector(d);
+            cflux[d].reset(new MultiFab(amrex::convert(cba,typ), cdm, ncomp, 0));
+            fflux[d].reset(new MultiFab(amrex::convert(fba,typ), fdm, ncomp, 0));
+            fill(*cflux[d], d);
+            fill(*fflux[d], 10.0+d);
+        }
+
+        MultiFab state0(cba, cdm, ncomp, 0);
+        fill(state0, 20.0);
+
+        // FluxRegister
+
+        FluxRegister fr(fba, fdm, ratio, 1, ncomp);
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            fr.CrseInit(*cflux[d], d, 0, 0, ncomp, -1.0);
+            fr.FineAdd(*fflux[d], d, 0, 0, ncomp, 1.0);
+        }
+
+        MultiFab state1(cba, cdm, ncomp, 0);
+        MultiFab state2(cba, cdm, ncomp, 0);
+        MultiFab::Copy(state1, state0, 0, 0, ncomp, 0);
+        MultiFab::Copy(state2, state0, 0, 0, ncomp, 0);
+
+        fr.Reflux(state1, 1.0, 0, 0, ncomp, cgeom);
+        fr.Reflux_nowait(state2, 1.0, 0, 0, ncomp, cgeom);
+        fr.Reflux_finish();
+
+        if (maxdiff(state1, state0) == 0.0) {
+            amrex::Abort("FluxRegister::Reflux: state unchanged");
+        }
+        if (maxdiff(state1, state2) != 0.0) {
+            amrex::Abort("FluxRegister::Reflux_nowait: results differ from Reflux");
+        }
+
+        // YAFluxRegister, whose Reflux consumes the registers
+
+        {
+            MultiFab fstate(fba, fdm, ncomp, 0);
+            std::array<std::unique_ptr<YAFluxRegister>,2> yafr;
+            std::array<MultiFab*,2> state{&state1, &state2};
+            const Real* cdx = cgeom.CellSize();
+            const Real* fdx = fgeom.CellSize();
+            for (int i = 0; i < 2; ++i)
+            {
+                yafr[i].reset(new YAFluxRegister(fba, cba, fdm, cdm, fgeom, cgeom,
+                                                 ratio, 1, ncomp));
+                yafr[i]->reset();
+                MultiFab::Copy(*state[i], state0, 0, 0, ncomp, 0);
+
+                for (MFIter mfi(*state[i]); mfi.isValid(); ++mfi) {
+                    if (yafr[i]->CrseHasWork(mfi)) {
+                        std::array<FArrayBox const*,AMREX_SPACEDIM> flux
+                            {AMREX_D_DECL(&(*cflux[0])[mfi],&(*cflux[1])[mfi],&(*cflux[2])[mfi])};
+                        yafr[i]->CrseAdd(mfi, flux, cdx, 1.0);
+                    }
+                }
+                for (MFIter mfi(fstate); mfi.isValid(); ++mfi) {
+                    if (yafr[i]->FineHasWork(mfi)) {
+                        std::array<FArrayBox const*,AMREX_SPACEDIM> flux
+                            {AMREX_D_DECL(&(*fflux[0])[mfi],&(*fflux[1])[mfi],&(*fflux[2])[mfi])};
+                        yafr[i]->FineAdd(mfi, flux, fdx, 0.5);
+                    }
+                }
+            }
+
+            yafr[0]->Reflux(state1);
+            yafr[1]->Reflux_nowait(state2);
+            yafr[1]->Reflux_finish();
+
+            if (maxdiff(state1, state0) == 0.0) {
+                amrex::Abort("YAFluxRegister::Reflux: state unchanged");
+            }
+            if (maxdiff(state1, state2) != 0.0) {
+                amrex::Abort("YAFluxRegister::Reflux_nowait: results differ from Reflux");
+            }
+        }
+
+        // Timings
+
+        MultiFab other(cba, cdm, ncomp, 0);
+        other.setVal(1.0);
+
+        Real t_blocking = ParallelDescriptor::second();
+        for (int i = 0; i < nrepeat; ++i) {
+            fr.Reflux(state1, 1.0, 0, 0, ncomp, cgeom);
+            work(other, nwork);
+        }
+        t_blocking = ParallelDescriptor::second() - t_blocking;
+
+        Real t_split = ParallelDescriptor::second();
+        for (int i = 0; i < nrepeat; ++i) {
+            fr.Reflux_nowait(state2, 1.0, 0, 0, ncomp, cgeom);
+            work(other, nwork);
+            fr.Reflux_finish();
+        }
+        t_split = ParallelDescriptor::second() - t_split;
+
+        if (maxdiff(state1, state2) != 0.0) {
+            amrex::Abort("FluxRegister::Reflux_nowait: repeated results differ from Reflux");
+        }
+
+        ParallelDescriptor::ReduceRealMax(t_blocking);
+        ParallelDescriptor::ReduceRealMax(t_split);
+        amrex::Print() << "Reflux and Reflux_nowait/Reflux_finish agree\n"
+                       << "Reflux + work: " << t_blocking << " s, "
+                       << "Reflux_nowait + work + Reflux_finish: " << t_split << " s\n";
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,195 @@
+// Test and timings of the C++ interpolation kernels of 3D.
+//
+// CellConservativeLinear, with both limiters, and NodeBilinear are run
+// with the Fortran kernels and with the C++ kernels specialized for the
+// refinement ratio, first on single fabs, including boxes that are not
+// aligned with the coarse cells and Dirichlet boundaries, and then in
+// FillPatchTwoLevels filling the ghost cells of a fine level.  The results
+// must be the same; the numbers of fine cells interpolated per second are
+// printed.
+
+#include <cmath>
+#include <iostream>
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Geometry.H>
+#include <AMReX_FillPatchUtil.H>
+#include <AMReX_Interpolater.H>
+#include <AMReX_Utility.H>
+
+using namespace amrex;
+
+namespace {
+
+// The domain is periodic, so there is nothing to fill.
+class NoPhysBC
+    : public PhysBCFunctBase
+{
+public:
+    virtual void FillBoundary (MultiFab& mf, int dcomp, int ncomp, Real time) override {}
+};
+
+// A smooth function with noise, so that the limiters are active.
+Real value (const IntVect& iv, int n, Real h)
+{
+    Real v = n;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        v += std::sin(2.0*M_PI*(iv[d]+0.5)*h + d);
+    }
+    return v + 0.1*amrex::Random();
+}
+
+void init (FArrayBox& fab, const Box& bx, Real h)
+{
+    for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv)) {
+        for (int n = 0; n < fab.nComp(); ++n) {
+            fab(iv,n) = value(iv, n, h);
+        }
+    }
+}
+
+void compare (const FArrayBox& a, const FArrayBox& b, const std::string& what)
+{
+    const long n = a.box().numPts()*a.nComp();
+    for (long i = 0; i < n; ++i) {
+        if (a.dataPtr()[i] != b.dataPtr()[i]) {
+            amrex::Print() << what << ": C++ and Fortran kernels differ\n";
+            amrex::Abort("wrong interpolation");
+        }
+    }
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 32;
+        int nghost = 4;
+        int ncomp = 4;
+        int nrep = 5;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nghost", nghost);
+            pp.query("ncomp", ncomp);
+            pp.query("nrep", nrep);
+        }
+
+        const Box cdomain(IntVect::TheZeroVector(), IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+        RealBox rb({AMREX_D_DECL(0.0,0.0,0.0)}, {AMREX_D_DECL(1.0,1.0,1.0)});
+        int is_per[] = {AMREX_D_DECL(1,1,1)};
+        const Geometry cgeom(cdomain, &rb, 0, is_per);
+        const Real h = 1.0/n_cell;
+
+        struct Case { const char* name; Interpolater* interp; bool node; };
+        const Case cases[] = { {"lincc_interp    ", &lincc_interp, false},
+                               {"cell_cons_interp", &cell_cons_interp, false},
+                               {"node_bilinear   ", &node_bilinear_interp, true} };
+
+        for (int ratio : {2, 4})
+        {
+            const IntVect rr(AMREX_D_DECL(ratio,ratio,ratio));
+            const Geometry fgeom(amrex::refine(cdomain, rr), &rb, 0, is_per);
+
+            amrex::Print() << "Ratio " << ratio << ", fine cells per second:\n";
+            //
+            // Single fabs.  The boxes have negative indices and are not
+            // aligned with the coarse cells, and the low x and high z faces
+            // have Dirichlet conditions for the cell-centered interpolaters.
+            //
+            {
+                const Box fbx(IntVect(AMREX_D_DECL(-13,-6,-9)), IntVect(AMREX_D_DECL(44,37,29)));
+                Vector<BCRec> bcr(ncomp, BCRec(AMREX_D_DECL(BCType::ext_dir,BCType::int_dir,BCType::int_dir),
+                                               AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::ext_dir)));
+
+                for (const Case& c : cases)
+                {
+                    const Box fb = c.node ? amrex::surroundingNodes(fbx) : fbx;
+                    const Box cb = c.interp->CoarseBox(fb, rr);
+                    FArrayBox crse(cb, ncomp);
+                    init(crse, cb, h);
+                    FArrayBox fine_f(fb, ncomp), fine_c(fb, ncomp);
+
+                    Real t[2] = {0.0, 0.0};
+                    for (int rep = 0; rep < nrep; ++rep) {
+                        for (int k = 0; k < 2; ++k) {
+                            Interpolater::use_fortran = (k == 0);
+                            FArrayBox& fine = (k == 0) ? fine_f : fine_c;
+                            fine.setVal(0.0);
+                            const Real t0 = ParallelDescriptor::second();
+                            c.interp->interp(crse, 0, fine, 0, ncomp, fb, rr, cgeom, fgeom, bcr, 0, 0);
+                            t[k] += ParallelDescriptor::second() - t0;
+                        }
+                        compare(fine_f, fine_c, c.name);
+                    }
+                    const Real ncells = Real(nrep)*fb.numPts()*ncomp;
+                    amrex::Print() << "  " << c.name << " fab  : Fortran " << ncells/t[0]
+                                   << ", C++ " << ncells/t[1] << "\n";
+                }
+            }
+            //
+            // The ghost cells of a fine level covering the middle of the
+            // domain filled by FillPatchTwoLevels.
+            //
+            {
+                BoxArray cba(cdomain);
+                cba.maxSize(max_grid_size);
+                DistributionMapping cdm(cba);
+
+                BoxArray fba(amrex::refine(Box(IntVect(AMREX_D_DECL(n_cell/4,n_cell/4,n_cell/4)),
+                                               IntVect(AMREX_D_DECL(3*n_cell/4-1,3*n_cell/4-1,3*n_cell/4-1))),
+                                           rr));
+                fba.maxSize(max_grid_size);
+                DistributionMapping fdm(fba);
+
+                MultiFab crse(cba, cdm, ncomp, 0);
+                for (MFIter mfi(crse); mfi.isValid(); ++mfi) {
+                    init(crse[mfi], mfi.validbox(), h);
+                }
+                MultiFab fine(fba, fdm, ncomp, 0);
+                fine.setVal(1.0);
+
+                NoPhysBC physbc;
+                Vector<BCRec> bcs(ncomp, BCRec(AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::int_dir),
+                                               AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::int_dir)));
+
+                long nghost_cells = -fba.numPts();
+                for (int i = 0; i < fba.size(); ++i) nghost_cells += amrex::grow(fba[i], nghost).numPts();
+                const Real ncells = Real(nrep)*nghost_cells*ncomp;
+
+                for (const Case& c : cases)
+                {
+                    if (c.node) continue;
+                    MultiFab mf_f(fba, fdm, ncomp, nghost), mf_c(fba, fdm, ncomp, nghost);
+                    Real t[2] = {0.0, 0.0};
+                    for (int rep = 0; rep < nrep; ++rep) {
+                        for (int k = 0; k < 2; ++k) {
+                            Interpolater::use_fortran = (k == 0);
+                            MultiFab& mf = (k == 0) ? mf_f : mf_c;
+                            const Real t0 = ParallelDescriptor::second();
+                            FillPatchTwoLevels(mf, 0.0, {&crse}, {0.0}, {&fine}, {0.0},
+                                               0, 0, ncomp, cgeom, fgeom, physbc, physbc,
+                                               rr, c.interp, bcs);
+                            t[k] += ParallelDescriptor::second() - t0;
+                        }
+                    }
+                    MultiFab::Subtract(mf_c, mf_f, 0, 0, ncomp, nghost);
+                    if (mf_c.norm0(0, nghost) != 0.0) {
+                        amrex::Print() << c.name << ": C++ and Fortran kernels differ\n";
+                        amrex::Abort("wrong interpolation");
+                    }
+                    ParallelDescriptor::ReduceRealMax(t, 2);
+                    amrex::Print() << "  " << c.name << " fill : Fortran " << ncells/t[0]
+                                   << ", C++ " << ncells/t[1] << "\n";
+                }
+            }
+        }
+        Interpolater::use_fortran = false;
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,155 @@
+// Test and timings of the incremental regrid of AmrMesh::MakeNewGrids.
+//
+// The cells in a spherical shell moving slowly across the domain are
+// tagged, and the grids of the fine levels are rebuilt from the tags at
+// every step, from scratch and in the incremental mode, which keeps the
+// grids that are still efficient.  The grids of level 1 are checked to be
+// disjoint and to cover all the tagged cells of level 0.  The numbers of
+// boxes of the fine levels and of those that are not in the grids of the
+// previous step, the efficiency of level 1 and the times are printed.
+
+#include <cmath>
+#include <iostream>
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_AmrMesh.H>
+#include <AMReX_TagBox.H>
+
+using namespace amrex;
+
+namespace {
+
+Real radius = 0.25;
+Real thickness = 0.02;
+Real speed = 0.005;
+
+bool tagged (const IntVect& iv, const Geometry& geom, Real time)
+{
+    const Real* dx = geom.CellSize();
+    const Real* plo = geom.ProbLo();
+    Real r2 = 0.0;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        const Real c = (d == 0) ? 0.4 + speed*time : 0.5;
+        const Real x = plo[d] + (iv[d]+0.5)*dx[d] - c;
+        r2 += x*x;
+    }
+    return std::abs(std::sqrt(r2) - radius) < thickness;
+}
+
+class ShellMesh
+    : public AmrMesh
+{
+public:
+    virtual void ErrorEst (int lev, TagBoxArray& tags, Real time, int /*ngrow*/) override
+    {
+        for (MFIter mfi(tags); mfi.isValid(); ++mfi)
+        {
+            TagBox& tagfab = tags[mfi];
+            const Box& bx = mfi.validbox();
+            for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv)) {
+                if (tagged(iv, Geom(lev), time)) tagfab(iv) = TagBox::SET;
+            }
+        }
+    }
+
+    // The grids of the fine levels at time, and the number of the boxes
+    // that are not in the old grids.
+    long regrid (Real time, Real& t)
+    {
+        Vector<BoxArray> new_grids(max_level+1);
+        int new_finest;
+        t = ParallelDescriptor::second();
+        MakeNewGrids(0, time, new_finest, new_grids);
+        t = ParallelDescriptor::second() - t;
+
+        long nchanged = 0;
+        for (int lev = 1; lev <= new_finest; ++lev)
+        {
+            const BoxArray& ba = new_grids[lev];
+            if (lev <= finest_level) {
+                for (int i = 0; i < ba.size(); ++i) {
+                    bool found = false;
+                    for (const auto& is : grids[lev].intersections(ba[i])) {
+                        if (grids[lev][is.first] == ba[i]) found = true;
+                    }
+                    if (!found) ++nchanged;
+                }
+            } else {
+                nchanged += ba.size();
+            }
+            SetBoxArray(lev, ba);
+            SetDistributionMap(lev, DistributionMapping(ba));
+        }
+        for (int lev = new_finest+1; lev <= finest_level; ++lev) {
+            ClearBoxArray(lev);
+            ClearDistributionMap(lev);
+        }
+        SetFinestLevel(new_finest);
+        return nchanged;
+    }
+};
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int nsteps = 10;
+        {
+            ParmParse pp;
+            pp.query("nsteps", nsteps);
+            pp.query("radius", radius);
+            pp.query("thickness", thickness);
+            pp.query("speed", speed);
+        }
+
+        for (int incremental = 0; incremental < 2; ++incremental)
+        {
+            ShellMesh mesh;
+            mesh.SetIncrementalRegrid(incremental);
+            mesh.MakeNewGrids(0.0);
+
+            long nboxes = 0, nchanged = 0, ncells = 0, ntags = 0;
+            Real t_regrid = 0.0;
+
+            for (int step = 1; step <= nsteps; ++step)
+            {
+                const Real time = step;
+                Real t;
+                nchanged += mesh.regrid(time, t);
+                t_regrid += t;
+
+                if (mesh.finestLevel() < 1) {
+                    amrex::Abort("no fine level");
+                }
+                const BoxArray& ba = mesh.boxArray(1);
+                if (!ba.isDisjoint()) {
+                    amrex::Abort("MakeNewGrids: boxes not disjoint");
+                }
+                const Box& domain = mesh.Geom(0).Domain();
+                const IntVect& rr = mesh.refRatio(0);
+                for (IntVect iv = domain.smallEnd(); iv <= domain.bigEnd(); domain.next(iv)) {
+                    if (tagged(iv, mesh.Geom(0), time)) {
+                        ++ntags;
+                        if (!ba.contains(amrex::refine(Box(iv,iv), rr))) {
+                            amrex::Abort("MakeNewGrids: tagged cell not covered");
+                        }
+                    }
+                }
+                ncells += amrex::coarsen(ba, rr).numPts();
+                for (int lev = 1; lev <= mesh.finestLevel(); ++lev) {
+                    nboxes += mesh.boxArray(lev).size();
+                }
+            }
+
+            ParallelDescriptor::ReduceRealMax(t_regrid);
+            amrex::Print() << (incremental ? "incremental" : "from scratch")
+                           << ": boxes " << nboxes << ", new boxes " << nchanged
+                           << ", level 1 efficiency " << Real(ntags)/Real(ncells)
+                           << ", time " << t_regrid << " s\n";
+        }
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,188 @@
+// Test and timings of the buffering and the coarsening of TagBoxes.
+//
+// Random cells are tagged on boxes with negative and positive indices,
+// and TagBoxArray::buffer, which dilates the tags one direction at a time,
+// and TagBoxArray::coarsen, which ORs whole rows of fine tags, are
+// compared with cell-by-cell implementations of the same operations.  The
+// times of both are printed.
+
+#include <algorithm>
+#include <iostream>
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Utility.H>
+#include <AMReX_TagBox.H>
+
+using namespace amrex;
+
+namespace {
+
+// Cell-by-cell buffering: the cells within nbuff of a SET cell in the
+// interior grow(box,-nwid) that are not SET become BUF.
+void buffer_cells (TagBox& tb, int nbuff, int nwid)
+{
+    const Box& inside = amrex::grow(tb.box(), -nwid);
+    for (IntVect iv = inside.smallEnd(); iv <= inside.bigEnd(); inside.next(iv))
+    {
+        if (tb(iv) == TagBox::SET)
+        {
+            const Box& nbr = amrex::grow(Box(iv,iv), nbuff) & tb.box();
+            for (IntVect jv = nbr.smallEnd(); jv <= nbr.bigEnd(); nbr.next(jv)) {
+                if (tb(jv) != TagBox::SET) tb(jv) = TagBox::BUF;
+            }
+        }
+    }
+}
+
+// Cell-by-cell coarsening: a coarse cell gets the largest tag of its fine
+// cells.
+void coarsen_cells (const TagBox& fine, TagBox& crse, const IntVect& ratio)
+{
+    crse.setVal(TagBox::CLEAR);
+    const Box& fbx = fine.box();
+    for (IntVect iv = fbx.smallEnd(); iv <= fbx.bigEnd(); fbx.next(iv))
+    {
+        const IntVect& civ = amrex::coarsen(iv, ratio);
+        crse(civ) = std::max(crse(civ), fine(iv));
+    }
+}
+
+void compare (const TagBoxArray& tags, const Vector<TagBox*>& ref, const std::string& what)
+{
+    long ndiff = 0;
+    for (MFIter mfi(tags); mfi.isValid(); ++mfi)
+    {
+        const TagBox& tb = tags[mfi];
+        const TagBox& rb = *ref[mfi.LocalIndex()];
+        if (tb.box() != rb.box()) {
+            amrex::Abort(what + ": wrong box");
+        }
+        const long n = tb.box().numPts();
+        for (long i = 0; i < n; ++i) {
+            if (tb.dataPtr()[i] != rb.dataPtr()[i]) ++ndiff;
+        }
+    }
+    ParallelDescriptor::ReduceLongSum(ndiff);
+    if (ndiff > 0) {
+        amrex::Print() << what << ": " << ndiff << " cells differ\n";
+        amrex::Abort("wrong tags");
+    }
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 128;
+        int max_grid_size = 64;
+        int n_error_buf = 2;
+        int ratio = 4;
+        Real fraction = 0.01;
+        int nrep = 5;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("n_error_buf", n_error_buf);
+            pp.query("ratio", ratio);
+            pp.query("fraction", fraction);
+            pp.query("nrep", nrep);
+        }
+
+        const Box domain(IntVect(AMREX_D_DECL(-n_cell/2,-n_cell/2,-n_cell/2)),
+                         IntVect(AMREX_D_DECL(n_cell/2-1,n_cell/2-1,n_cell/2-1)));
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dmap(ba);
+
+        const IntVect rr(AMREX_D_DECL(ratio,ratio,ratio));
+
+        Real t_buffer = 0.0, t_cells_buffer = 0.0;
+        Real t_coarsen = 0.0, t_cells_coarsen = 0.0;
+        long ntags = 0;
+
+        for (int rep = 0; rep < nrep; ++rep)
+        {
+            TagBoxArray tags(ba, dmap, n_error_buf);
+            tags.setVal(TagBox::CLEAR);
+            for (MFIter mfi(tags); mfi.isValid(); ++mfi)
+            {
+                TagBox& tb = tags[mfi];
+                const Box& bx = mfi.validbox();
+                for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv)) {
+                    if (amrex::Random() < fraction) tb(iv) = TagBox::SET;
+                }
+            }
+
+            Vector<TagBox*> ref;
+            for (MFIter mfi(tags); mfi.isValid(); ++mfi) {
+                ref.push_back(new TagBox(tags[mfi].box()));
+                ref.back()->copy(tags[mfi]);
+            }
+
+            Real t = ParallelDescriptor::second();
+            tags.buffer(n_error_buf);
+            t_buffer += ParallelDescriptor::second() - t;
+
+            t = ParallelDescriptor::second();
+            for (TagBox* rb : ref) buffer_cells(*rb, n_error_buf, n_error_buf);
+            t_cells_buffer += ParallelDescriptor::second() - t;
+
+            compare(tags, ref, "buffer");
+            ntags = tags.numTags();
+
+            Vector<TagBox*> cref;
+            t = ParallelDescriptor::second();
+            for (TagBox* rb : ref) {
+                cref.push_back(new TagBox(amrex::coarsen(rb->box(), rr)));
+                coarsen_cells(*rb, *cref.back(), rr);
+            }
+            t_cells_coarsen += ParallelDescriptor::second() - t;
+
+            t = ParallelDescriptor::second();
+            tags.coarsen(rr);
+            t_coarsen += ParallelDescriptor::second() - t;
+
+            compare(tags, cref, "coarsen");
+
+            for (TagBox* rb : ref) delete rb;
+            for (TagBox* rb : cref) delete rb;
+        }
+
+        //
+        // A SET cell at a corner, whose buffer is cut by the box, and one
+        // inside.
+        //
+        {
+            const Box bx(IntVect(AMREX_D_DECL(-70,-3,-5)), IntVect(AMREX_D_DECL(70,4,6)));
+            TagBox tb(bx);
+            const IntVect corner = bx.smallEnd();
+            const IntVect inner(AMREX_D_DECL(0,0,0));
+            tb(corner) = TagBox::SET;
+            tb(inner) = TagBox::SET;
+            TagBox rb(bx);
+            rb.copy(tb);
+            tb.buffer(3, 0);
+            buffer_cells(rb, 3, 0);
+            for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv)) {
+                if (tb(iv) != rb(iv)) amrex::Abort("TagBox::buffer");
+            }
+            if (tb.numTags() != AMREX_D_TERM(4,*4,*4) + AMREX_D_TERM(7,*7,*7)) {
+                amrex::Abort("TagBox::buffer: wrong number of tags");
+            }
+        }
+
+        ParallelDescriptor::ReduceRealMax(t_buffer);
+        ParallelDescriptor::ReduceRealMax(t_cells_buffer);
+        ParallelDescriptor::ReduceRealMax(t_coarsen);
+        ParallelDescriptor::ReduceRealMax(t_cells_coarsen);
+
+        amrex::Print() << "Cells: " << domain.numPts() << ", tags after buffering: " << ntags << "\n"
+                       << "  buffer : TagBox " << t_buffer << " s, cell by cell " << t_cells_buffer << " s\n"
+                       << "  coarsen: TagBox " << t_coarsen << " s, cell by cell " << t_cells_coarsen << " s\n";
+    }
+    amrex::Finalize();
+}
@@ -19,6 +19,9 @@ namespace {
     static int linop_maxorder = 2;
     static bool agglomeration = false;
     static bool consolidation = false;
+    static bool mixed_precision = false;
+    static int chebyshev_degree = 0;
+    static std::string stats_file;
 }
 
 void solve_with_mlmg (const Vector<Geometry>& geom, int ref_ratio,
@@ -39,6 +42,9 @@ void solve_with_mlmg (const Vector<Geometry>& geom, int ref_ratio,
         pp.query("linop_maxorder", linop_maxorder);
         pp.query("agglomeration", agglomeration);
         pp.query("consolidation", consolidation);
+        pp.query("mixed_precision", mixed_precision);
+        pp.query("chebyshev_degree", chebyshev_degree);
+        pp.query("stats_file", stats_file);
     }
 
     LPInfo info;
@@ -69,6 +75,7 @@ void solve_with_mlmg (const Vector<Geometry>& geom, int ref_ratio,
         MLABecLaplacian mlabec(geom, grids, dmap, info);
 
         mlabec.setMaxOrder(linop_maxorder);
+        mlabec.setChebyshevSmoother(chebyshev_degree);
         
         // BC
         mlabec.setDomainBC({prob::bc_type,prob::bc_type,prob::bc_type},
@@ -101,8 +108,14 @@ void solve_with_mlmg (const Vector<Geometry>& geom, int ref_ratio,
         mlmg.setMaxFmgIter(max_fmg_iter);
         mlmg.setVerbose(verbose);
         mlmg.setCGVerbose(cg_verbose);
+        mlmg.setMixedPrecision(mixed_precision);
+        mlmg.setInstrumentation(!stats_file.empty());
         
         mlmg.solve(psoln, prhs, tol_rel, tol_abs);
+
+        if (!stats_file.empty()) {
+            mlmg.writeSolveStats(stats_file);
+        }
     }
     else
     {
@@ -119,6 +132,7 @@ void solve_with_mlmg (const Vector<Geometry>& geom, int ref_ratio,
                                    {soln[ilev].DistributionMap()});
 
             mlabec.setMaxOrder(linop_maxorder);
+            mlabec.setChebyshevSmoother(chebyshev_degree);
 
             mlabec.setDomainBC({prob::bc_type,prob::bc_type,prob::bc_type},
                                {prob::bc_type,prob::bc_type,prob::bc_type});
@@ -150,8 +164,14 @@ void solve_with_mlmg (const Vector<Geometry>& geom, int ref_ratio,
             mlmg.setMaxFmgIter(max_fmg_iter);
             mlmg.setVerbose(verbose);
             mlmg.setCGVerbose(cg_verbose);
+            mlmg.setMixedPrecision(mixed_precision);
+            mlmg.setInstrumentation(!stats_file.empty());
         
             mlmg.solve({&soln[ilev]}, {&rhs[ilev]}, tol_rel, tol_abs);
+
+            if (!stats_file.empty()) {
+                mlmg.writeSolveStats(stats_file + "." + std::to_string(ilev));
+            }
         }
     }
 }
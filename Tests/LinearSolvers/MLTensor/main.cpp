@@ -0,0 +1,285 @@
+
+// Test of MLTensorOp with a manufactured solution,
+//
+//     alpha * u - beta * div (eta (grad u + (grad u)^T)) = rhs,
+//
+// with u_i = sin(k x_i) prod_{d!=i} cos(k x_d) and
+// eta = 2 + prod_d cos(k x_d), where k = 2 pi.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_MLMG.H>
+#include <AMReX_MLTensorOp.H>
+
+using namespace amrex;
+
+namespace {
+    int max_level     = 1;
+    int n_cell        = 64;
+    int max_grid_size = 32;
+    int ref_ratio     = 2;
+    int verbose       = 2;
+    int max_iter      = 100;
+    int max_fmg_iter  = 0;
+    Real alpha        = 1.0;
+    Real beta         = 1.0;
+    MLLinOp::BCType bc_type = MLLinOp::BCType::Dirichlet;
+
+    const Real kk = 2.0*3.141592653589793238462643383279502884197;
+
+    // f(k x) of direction d for component i, and its first and second derivatives
+    Real ff (int i, int d, Real x, int deriv)
+    {
+        const Real s = std::sin(kk*x);
+        const Real c = std::cos(kk*x);
+        if (i == d) {
+            return (deriv == 0) ? s : ((deriv == 1) ? kk*c : -kk*kk*s);
+        } else {
+            return (deriv == 0) ? c : ((deriv == 1) ? -kk*s : -kk*kk*c);
+        }
+    }
+
+    // d^a/dx_j^a d^b/dx_k^b u_i
+    Real du (int i, const Real* x, int j, int k)
+    {
+        Real r = 1.0;
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            const int deriv = (d == j) + (d == k);
+            r *= ff(i, d, x[d], deriv);
+        }
+        return r;
+    }
+
+    Real eta (const Real* x)
+    {
+        Real r = 1.0;
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) r *= std::cos(kk*x[d]);
+        return 2.0 + r;
+    }
+
+    Real deta (const Real* x, int j)
+    {
+        Real r = 1.0;
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            r *= (d == j) ? -kk*std::sin(kk*x[d]) : std::cos(kk*x[d]);
+        }
+        return r;
+    }
+
+    Real exact_rhs (int i, const Real* x)
+    {
+        const int none = -1;
+        Real divstress = 0.0;
+        for (int j = 0; j < AMREX_SPACEDIM; ++j) {
+            divstress += deta(x,j) * (du(i,x,j,none) + du(j,x,i,none))
+                +        eta(x)    * (du(i,x,j,j)    + du(j,x,i,j));
+        }
+        return alpha*du(i,x,none,none) - beta*divstress;
+    }
+
+    void build_geometry_and_grids (Vector<Geometry>& geom, Vector<BoxArray>& grids);
+    void init_prob (const Vector<Geometry>& geom, Vector<MultiFab>& soln, Vector<MultiFab>& rhs,
+                    Vector<MultiFab>& exact, Vector<std::array<MultiFab,AMREX_SPACEDIM> >& eta_face);
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+
+    {
+        BL_PROFILE("main()");
+
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_level", max_level);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("ref_ratio", ref_ratio);
+            pp.query("verbose", verbose);
+            pp.query("max_iter", max_iter);
+            pp.query("max_fmg_iter", max_fmg_iter);
+            pp.query("alpha", alpha);
+            pp.query("beta", beta);
+            std::string bc_type_s{"Dirichlet"};
+            pp.query("bc_type", bc_type_s);
+            if (bc_type_s == "Periodic") {
+                bc_type = MLLinOp::BCType::Periodic;
+            } else {
+                AMREX_ALWAYS_ASSERT_WITH_MESSAGE(bc_type_s == "Dirichlet",
+                                                 "bc_type must be Dirichlet or Periodic");
+            }
+        }
+
+        Vector<Geometry> geom;
+        Vector<BoxArray> grids;
+        build_geometry_and_grids(geom, grids);
+        const int nlevels = geom.size();
+
+        Vector<MultiFab> soln(nlevels);
+        Vector<MultiFab> exact(nlevels);
+        Vector<MultiFab> rhs(nlevels);
+        Vector<std::array<MultiFab,AMREX_SPACEDIM> > eta_face(nlevels);
+        Vector<DistributionMapping> dmap(nlevels);
+
+        for (int ilev = 0; ilev < nlevels; ++ilev)
+        {
+            dmap[ilev].define(grids[ilev]);
+            soln [ilev].define(grids[ilev], dmap[ilev], AMREX_SPACEDIM, 1);
+            exact[ilev].define(grids[ilev], dmap[ilev], AMREX_SPACEDIM, 0);
+            rhs  [ilev].define(grids[ilev], dmap[ilev], AMREX_SPACEDIM, 0);
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                eta_face[ilev][idim].define(amrex::convert(grids[ilev],
+                                                           IntVect::TheDimensionVector(idim)),
+                                            dmap[ilev], 1, 0);
+            }
+        }
+
+        init_prob(geom, soln, rhs, exact, eta_face);
+
+        MLTensorOp mltensor(geom, grids, dmap);
+        mltensor.setDomainBC({AMREX_D_DECL(bc_type,bc_type,bc_type)},
+                             {AMREX_D_DECL(bc_type,bc_type,bc_type)});
+        for (int ilev = 0; ilev < nlevels; ++ilev) {
+            mltensor.setLevelBC(ilev, &soln[ilev]);
+        }
+
+        mltensor.setScalars(alpha, beta);
+        for (int ilev = 0; ilev < nlevels; ++ilev)
+        {
+            MultiFab acoef(grids[ilev], dmap[ilev], 1, 0);
+            acoef.setVal(1.0);
+            mltensor.setACoeffs(ilev, acoef);
+            mltensor.setShearViscosity(ilev, amrex::GetArrOfConstPtrs(eta_face[ilev]));
+        }
+
+        MLMG mlmg(mltensor);
+        mlmg.setMaxIter(max_iter);
+        mlmg.setMaxFmgIter(max_fmg_iter);
+        mlmg.setVerbose(verbose);
+
+        const Real tol_rel = 1.e-10;
+        const Real tol_abs = 0.0;
+        mlmg.solve(amrex::GetVecOfPtrs(soln), amrex::GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+
+        for (int ilev = 0; ilev < nlevels; ++ilev)
+        {
+            MultiFab::Subtract(exact[ilev], soln[ilev], 0, 0, AMREX_SPACEDIM, 0);
+            for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                amrex::Print() << "Max error of component " << n << " on level " << ilev
+                               << ": " << exact[ilev].norm0(n) << "\n";
+            }
+        }
+    }
+
+    amrex::Finalize();
+}
+
+namespace {
+
+void build_geometry_and_grids (Vector<Geometry>& geom, Vector<BoxArray>& grids)
+{
+    const int nlevels = max_level + 1;
+    geom.resize(nlevels);
+    grids.resize(nlevels);
+
+    IntVect dom0_lo {IntVect::TheZeroVector()};
+    IntVect dom0_hi {AMREX_D_DECL(n_cell-1, n_cell-1, n_cell-1)};
+    Box dom0 {dom0_lo, dom0_hi};
+    BoxArray ba0{dom0};
+
+    grids[0] = ba0;
+    grids[0].maxSize(max_grid_size);
+
+    for (int ilev = 1; ilev < nlevels; ++ilev)
+    {
+        ba0.grow(-n_cell/4);
+        ba0.refine(ref_ratio);
+        grids[ilev] = ba0;
+        grids[ilev].maxSize(max_grid_size);
+    }
+
+    std::array<Real,AMREX_SPACEDIM> prob_lo{AMREX_D_DECL(0.,0.,0.)};
+    std::array<Real,AMREX_SPACEDIM> prob_hi{AMREX_D_DECL(1.,1.,1.)};
+    RealBox real_box{prob_lo, prob_hi};
+
+    const int coord = 0;  // Cartesian coordinates
+    const int periodic = (bc_type == MLLinOp::BCType::Periodic);
+    std::array<int,AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(periodic,periodic,periodic)};
+
+    geom[0].define(dom0, &real_box, coord, is_periodic.data());
+    for (int ilev = 1; ilev < nlevels; ++ilev)
+    {
+        dom0.refine(ref_ratio);
+        geom[ilev].define(dom0, &real_box, coord, is_periodic.data());
+    }
+}
+
+void init_prob (const Vector<Geometry>& geom, Vector<MultiFab>& soln, Vector<MultiFab>& rhs,
+                Vector<MultiFab>& exact, Vector<std::array<MultiFab,AMREX_SPACEDIM> >& eta_face)
+{
+    const int none = -1;
+    const int nlevels = geom.size();
+    for (int ilev = 0; ilev < nlevels; ++ilev)
+    {
+        const Real* problo = geom[ilev].ProbLo();
+        const Real* dx     = geom[ilev].CellSize();
+        const Box& domain  = geom[ilev].Domain();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(soln[ilev]); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.validbox();
+            const Box& gbx = mfi.fabbox();
+            FArrayBox& solfab = soln[ilev][mfi];
+
+            // Initial guess is zero.  Ghost cells outside the domain hold
+            // the Dirichlet boundary values at the domain faces.
+            solfab.setVal(0.0);
+            for (IntVect iv = gbx.smallEnd(); iv <= gbx.bigEnd(); gbx.next(iv))
+            {
+                if (domain.contains(iv)) continue;
+                Real x[AMREX_SPACEDIM];
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    const Real xlo = problo[d] + dx[d]*domain.smallEnd(d);
+                    const Real xhi = problo[d] + dx[d]*(domain.bigEnd(d)+1);
+                    x[d] = problo[d] + (iv[d]+0.5)*dx[d];
+                    x[d] = std::max(xlo, std::min(xhi, x[d]));
+                }
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    solfab(iv,n) = du(n,x,none,none);
+                }
+            }
+
+            for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv))
+            {
+                Real x[AMREX_SPACEDIM];
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    x[d] = problo[d] + (iv[d]+0.5)*dx[d];
+                }
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    exact[ilev][mfi](iv,n) = du(n,x,none,none);
+                    rhs[ilev][mfi](iv,n) = exact_rhs(n,x);
+                }
+            }
+
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+            {
+                FArrayBox& efab = eta_face[ilev][idim][mfi];
+                const Box& nbx = efab.box();
+                for (IntVect iv = nbx.smallEnd(); iv <= nbx.bigEnd(); nbx.next(iv))
+                {
+                    Real x[AMREX_SPACEDIM];
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                        x[d] = problo[d] + (iv[d] + ((d == idim) ? 0.0 : 0.5))*dx[d];
+                    }
+                    efab(iv) = eta(x);
+                }
+            }
+        }
+    }
+}
+
+}
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <iomanip>
 
 #include <AMReX.H>
 #include <AMReX_MultiFab.H>
@@ -6,6 +7,10 @@
 #include "AMReX_Particles.H"
 #include "AMReX_PlotFileUtil.H"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace amrex;
 
 struct TestParams {
@@ -15,6 +20,8 @@ struct TestParams {
   int max_grid_size;
   int nppc;
   bool verbose;
+  int max_threads;
+  int nrep;
 };
 
 void test_assign_density(TestParams& parms)
@@ -76,6 +83,76 @@ void test_assign_density(TestParams& parms)
 
   //  myPC.InterpolateSingleLevelFort(acceleration, 0);
 
+  // Deposit again with the particles sorted by cell and in the
+  // structure-of-arrays layout.
+  MultiFab partMF_soa(ba, dmap, 1 + BL_SPACEDIM, 1);
+  myPC.SortParticlesByCell(0);
+  const long np_aos = myPC.NumberOfParticlesAtLevel(0);
+  myPC.ConvertToSoA(0);
+  if (myPC.NumberOfParticlesAtLevel(0) != np_aos) {
+    amrex::Abort("NumberOfParticlesAtLevel differs in the SoA mode");
+  }
+  myPC.AssignCellDensitySingleLevelFort(0, partMF_soa, 0, 4, 0);
+  myPC.ConvertToAoS(0);
+  MultiFab::Subtract(partMF_soa, partMF, 0, 0, 1 + BL_SPACEDIM, 0);
+  for (int n = 0; n < 1 + BL_SPACEDIM; ++n) {
+    amrex::Print() << "Max AoS/SoA difference of component " << n << " : "
+                   << partMF_soa.norm0(n) << '\n';
+  }
+
+  // Deposit with the tile-private buffers, which must give the same result
+  // for CIC, and check that the other shapes conserve the mass.
+  {
+    MultiFab partMF_tiled(ba, dmap, 1 + BL_SPACEDIM, 1);
+    myPC.DepositCellDensitySingleLevel(0, partMF_tiled, 0, DepositionShape::CIC, 4);
+    MultiFab::Subtract(partMF_tiled, partMF, 0, 0, 1 + BL_SPACEDIM, 0);
+    for (int n = 0; n < 1 + BL_SPACEDIM; ++n) {
+      amrex::Print() << "Max atomic/tiled difference of component " << n << " : "
+                     << partMF_tiled.norm0(n) << '\n';
+    }
+
+    const Real vol = AMREX_D_TERM(geom.CellSize(0), *geom.CellSize(1), *geom.CellSize(2));
+    const std::array<DepositionShape,3> shapes
+      {{DepositionShape::NGP, DepositionShape::CIC, DepositionShape::TSC}};
+    const std::array<std::string,3> names {{"NGP", "CIC", "TSC"}};
+    for (int s = 0; s < 3; ++s) {
+      myPC.DepositCellDensitySingleLevel(0, partMF_tiled, 0, shapes[s], 1);
+      amrex::Print() << names[s] << " mass : " << partMF_tiled.sum(0)*vol
+                     << " (expected " << mass*num_particles << ")\n";
+    }
+  }
+
+#ifdef _OPENMP
+  // Thread scaling of the deposition with atomics and with tile-private
+  // buffers.  The tiles should be small enough for all the threads to
+  // have work, e.g., particles.do_tiling = 1 and particles.tile_size = 8 8 8.
+  {
+    const int nthreads_save = omp_get_max_threads();
+    amrex::Print() << "\n threads   atomic CIC   tiled NGP   tiled CIC   tiled TSC  (seconds)\n";
+    for (int nthreads = 1; nthreads <= parms.max_threads; nthreads *= 2) {
+      omp_set_num_threads(nthreads);
+      Real t[4];
+      for (int m = 0; m < 4; ++m) {
+        Real t0 = ParallelDescriptor::second();
+        for (int r = 0; r < parms.nrep; ++r) {
+          if (m == 0) {
+            myPC.AssignCellDensitySingleLevelFort(0, partMF, 0, 1, 0);
+          } else {
+            myPC.DepositCellDensitySingleLevel(0, partMF, 0, static_cast<DepositionShape>(m-1), 1);
+          }
+        }
+        t[m] = (ParallelDescriptor::second() - t0) / parms.nrep;
+        ParallelDescriptor::ReduceRealMax(t[m]);
+      }
+      amrex::Print() << std::setw(8) << nthreads << std::fixed << std::setprecision(5)
+                     << std::setw(13) << t[0] << std::setw(12) << t[1]
+                     << std::setw(12) << t[2] << std::setw(12) << t[3] << '\n';
+    }
+    omp_set_num_threads(nthreads_save);
+  }
+#endif
+
+  myPC.AssignCellDensitySingleLevelFort(0, partMF, 0, 4, 0);
   MultiFab::Copy(density, partMF, 0, 0, 1, 0);
 
   WriteSingleLevelPlotfile("plt00000", partMF, 
@@ -103,6 +180,11 @@ int main(int argc, char* argv[])
   
   parms.verbose = false;
   pp.query("verbose", parms.verbose);
+
+  parms.max_threads = 64;
+  pp.query("max_threads", parms.max_threads);
+  parms.nrep = 5;
+  pp.query("nrep", parms.nrep);
   
   if (parms.verbose && ParallelDescriptor::IOProcessor()) {
     std::cout << std::endl;
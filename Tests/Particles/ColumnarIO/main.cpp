@@ -0,0 +1,172 @@
+
+// Test and timings of the columnar particle checkpoint format.
+//
+// The particles are written with Checkpoint and with CheckpointColumnar,
+// read back with Restart, and the restarted containers are compared with
+// the original one.  Then the positions alone are read from the columnar
+// files with a ParticleColumnarHeader, as an analysis tool would do.
+// Finally, the columnar checkpoint is written from the particles in the
+// structure-of-arrays layout and checked the same way.
+
+#include <iostream>
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Particles.H>
+
+using namespace amrex;
+
+namespace {
+
+using MyParticleContainer = ParticleContainer<1, 1, 2, 1>;
+using MyParIter           = ParIter<1, 1, 2, 1>;
+
+// The sums of all the components, and of the ids, of the valid particles.
+Vector<Real> checksums (MyParticleContainer& pc)
+{
+    Vector<Real> sums(AMREX_SPACEDIM+1+2+3, 0.0);
+    for (MyParIter pti(pc, 0); pti.isValid(); ++pti) {
+        const auto& aos = pti.GetArrayOfStructs();
+        const auto& soa = pti.GetStructOfArrays();
+        for (int i = 0; i < aos.numParticles(); ++i) {
+            const auto& p = aos[i];
+            int n = 0;
+            for (int d = 0; d < AMREX_SPACEDIM+1; ++d) sums[n++] += p.m_rdata.arr[d];
+            for (int j = 0; j < 2; ++j) sums[n++] += soa.GetRealData(j)[i];
+            sums[n++] += p.id();
+            sums[n++] += p.m_idata.arr[2];
+            sums[n++] += soa.GetIntData(0)[i];
+        }
+    }
+    ParallelDescriptor::ReduceRealSum(sums.dataPtr(), sums.size());
+    return sums;
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 16;
+        int nppc = 2;
+        int nrep = 3;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nppc", nppc);
+            pp.query("nrep", nrep);
+        }
+
+        RealBox real_box;
+        for (int n = 0; n < AMREX_SPACEDIM; n++) {
+            real_box.setLo(n, 0.0);
+            real_box.setHi(n, 1.0);
+        }
+        const Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+                         IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+        int is_per[AMREX_SPACEDIM];
+        for (int i = 0; i < AMREX_SPACEDIM; i++) is_per[i] = 1;
+        Geometry geom(domain, &real_box, CoordSys::cartesian, is_per);
+
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dmap(ba);
+
+        MyParticleContainer myPC(geom, dmap, ba);
+        MyParticleContainer::ParticleInitData pdata = {{1.0},{},{2.0,3.0},{7}};
+        myPC.InitRandom(long(nppc)*domain.numPts(), 451, pdata, false);
+
+        // Make the data of each particle different.
+        for (MyParIter pti(myPC, 0); pti.isValid(); ++pti) {
+            auto& aos = pti.GetArrayOfStructs();
+            auto& soa = pti.GetStructOfArrays();
+            for (int i = 0; i < aos.numParticles(); ++i) {
+                auto& p = aos[i];
+                p.m_rdata.arr[AMREX_SPACEDIM] = p.pos(0) + 1.0;
+                p.m_idata.arr[2] = p.id() % 13;
+                soa.GetRealData(0)[i] = p.pos(1);
+                soa.GetRealData(1)[i] = 2.0*p.id();
+                soa.GetIntData(0)[i] = p.id() % 7;
+            }
+        }
+
+        const long np = myPC.TotalNumberOfParticles();
+        amrex::Print() << "Number of particles : " << np << "\n";
+
+        const Vector<Real> sums = checksums(myPC);
+
+        Real t_write = 0.0, t_write_col = 0.0, t_read = 0.0, t_read_col = 0.0, t_read_pos = 0.0;
+        bool pass = true;
+        for (int rep = 0; rep < nrep; ++rep)
+        {
+            ParallelDescriptor::Barrier();
+            Real t0 = ParallelDescriptor::second();
+            myPC.Checkpoint("chk_aos", "particles");
+            ParallelDescriptor::Barrier();
+            Real t1 = ParallelDescriptor::second();
+            myPC.CheckpointColumnar("chk_col", "particles");
+            ParallelDescriptor::Barrier();
+            Real t2 = ParallelDescriptor::second();
+            t_write     += t1 - t0;
+            t_write_col += t2 - t1;
+
+            {
+                MyParticleContainer aosPC(geom, dmap, ba);
+                ParallelDescriptor::Barrier();
+                t0 = ParallelDescriptor::second();
+                aosPC.Restart("chk_aos", "particles");
+                ParallelDescriptor::Barrier();
+                t_read += ParallelDescriptor::second() - t0;
+                pass = pass && checksums(aosPC) == sums;
+            }
+            {
+                MyParticleContainer colPC(geom, dmap, ba);
+                ParallelDescriptor::Barrier();
+                t0 = ParallelDescriptor::second();
+                colPC.Restart("chk_col", "particles");
+                ParallelDescriptor::Barrier();
+                t_read_col += ParallelDescriptor::second() - t0;
+                pass = pass && colPC.OK() && colPC.TotalNumberOfParticles() == np
+                            && checksums(colPC) == sums;
+            }
+
+            // Read only the positions, on the I/O processor.
+            t0 = ParallelDescriptor::second();
+            ParticleColumnarHeader hdr("chk_col/particles");
+            if (ParallelDescriptor::IOProcessor()) {
+                const char* names[] = {"particle_position_x", "particle_position_y", "particle_position_z"};
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    Vector<Real> x;
+                    hdr.ReadRealComp(0, hdr.realComp(names[d]), x);
+                    Real s = 0.0;
+                    for (Real v : x) s += v;
+                    pass = pass && long(x.size()) == np && std::abs(s - sums[d]) <= 1.e-10*std::abs(sums[d]);
+                }
+            }
+            t_read_pos += ParallelDescriptor::second() - t0;
+        }
+
+        // Write the particles in the structure-of-arrays layout.
+        myPC.ConvertToSoA(0);
+        myPC.CheckpointColumnar("chk_col", "particles");
+        myPC.ConvertToAoS(0);
+        {
+            MyParticleContainer colPC(geom, dmap, ba);
+            colPC.Restart("chk_col", "particles");
+            pass = pass && colPC.TotalNumberOfParticles() == np && checksums(colPC) == sums;
+        }
+
+        ParallelDescriptor::ReduceBoolAnd(pass);
+
+        amrex::Print() << "Checkpoint         : " << t_write/nrep     << " s\n"
+                       << "CheckpointColumnar : " << t_write_col/nrep << " s\n"
+                       << "Restart            : " << t_read/nrep      << " s\n"
+                       << "Restart, columnar  : " << t_read_col/nrep  << " s\n"
+                       << "Positions only     : " << t_read_pos/nrep  << " s\n";
+        amrex::Print() << (pass ? "pass" : "FAIL") << "\n";
+    }
+    amrex::Finalize();
+}
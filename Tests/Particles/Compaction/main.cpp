@@ -0,0 +1,218 @@
+// Test and timings of the removal of invalid particles without Redistribute.
+//
+// The particles beyond x = keep_x are invalidated, as an outflow boundary
+// would do, and removed with RemoveInvalidParticles, first with the tiles
+// in the AoS mode and then in the SoA mode.  The remaining particles are
+// compared with the ones that were kept, and the memory of the tiles and
+// the time of a loop over the particles are printed before and after.
+
+#include <cmath>
+#include <iostream>
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Particles.H>
+
+using namespace amrex;
+
+namespace {
+
+using MyParticleContainer = ParticleContainer<1, 1, 2, 1>;
+using MyParIter           = ParIter<1, 1, 2, 1>;
+
+// The sums of the positions, of the data and of the ids of the valid
+// particles, and their number.
+Vector<Real> checksums (const MyParticleContainer& pc)
+{
+    Vector<Real> sums(AMREX_SPACEDIM+5, 0.0);
+    for (const auto& kv : pc.GetParticles(0)) {
+        const auto& aos = kv.second.GetArrayOfStructs();
+        const auto& soa = kv.second.GetStructOfArrays();
+        for (int i = 0; i < aos.numParticles(); ++i) {
+            const auto& p = aos[i];
+            if (p.id() <= 0) continue;
+            int n = 0;
+            for (int d = 0; d < AMREX_SPACEDIM+1; ++d) sums[n++] += p.m_rdata.arr[d];
+            for (int j = 0; j < 2; ++j) sums[n++] += soa.GetRealData(j)[i];
+            sums[n++] += p.id();
+            sums[n++] += 1.0;
+        }
+    }
+    ParallelDescriptor::ReduceRealSum(sums.dataPtr(), sums.size());
+    return sums;
+}
+
+// The bytes allocated for the particles on this process.
+long bytes (const MyParticleContainer& pc)
+{
+    long b = 0;
+    for (const auto& kv : pc.GetParticles(0)) {
+        const auto& soa = kv.second.GetStructOfArrays();
+        b += kv.second.capacity() * sizeof(MyParticleContainer::ParticleType);
+        for (int j = 0; j < 2; ++j) b += soa.GetRealData(j).capacity() * sizeof(Real);
+        b += soa.GetIntData(0).capacity() * sizeof(int);
+    }
+    ParallelDescriptor::ReduceLongSum(b);
+    return b;
+}
+
+// Time of nrep loops over all the particles, skipping the invalid ones.
+Real loop_time (MyParticleContainer& pc, int nrep)
+{
+    Real sum = 0.0;
+    Real t = ParallelDescriptor::second();
+    for (int r = 0; r < nrep; ++r) {
+        for (MyParIter pti(pc, 0); pti.isValid(); ++pti) {
+            const auto& aos = pti.GetArrayOfStructs();
+            const auto& rdata = pti.GetStructOfArrays().GetRealData(0);
+            for (int i = 0; i < aos.numParticles(); ++i) {
+                if (aos[i].id() > 0) sum += aos[i].m_rdata.pos[0] * rdata[i];
+            }
+        }
+    }
+    t = ParallelDescriptor::second() - t;
+    ParallelDescriptor::ReduceRealMax(t);
+    ParallelDescriptor::ReduceRealSum(sum);
+    return t;
+}
+
+// Invalidates the particles beyond x, in the AoS or the SoA mode.
+long invalidate (MyParticleContainer& pc, Real x)
+{
+    long n = 0;
+    for (auto& kv : pc.GetParticles(0)) {
+        auto& tile = kv.second;
+        if (tile.isSoA()) {
+            auto& sp = tile.GetSoAParticles();
+            for (int i = 0; i < sp.numParticles(); ++i) {
+                if (sp.pos(0)[i] > x && sp.id()[i] > 0) {
+                    sp.id()[i] = -sp.id()[i];
+                    ++n;
+                }
+            }
+        } else {
+            for (auto& p : tile.GetArrayOfStructs()) {
+                if (p.m_rdata.pos[0] > x && p.id() > 0) {
+                    p.m_idata.id = -p.m_idata.id;
+                    ++n;
+                }
+            }
+        }
+    }
+    ParallelDescriptor::ReduceLongSum(n);
+    return n;
+}
+
+void check (const MyParticleContainer& pc, const Vector<Real>& ref, long nremoved, long ninvalid)
+{
+    const Vector<Real>& sums = checksums(pc);
+    for (int n = 0; n < ref.size(); ++n) {
+        if (std::abs(sums[n]-ref[n]) > 1.e-9*std::abs(ref[n])) {
+            amrex::Print() << "component " << n << ": " << sums[n] << " != " << ref[n] << "\n";
+            amrex::Abort("RemoveInvalidParticles changed the valid particles");
+        }
+    }
+    if (nremoved != ninvalid || pc.TotalNumberOfParticles(false) != long(ref.back())) {
+        amrex::Abort("RemoveInvalidParticles did not remove the invalid particles");
+    }
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 32;
+        int nppc = 4;
+        Real keep_x = 0.2;
+        int nrep = 10;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nppc", nppc);
+            pp.query("keep_x", keep_x);
+            pp.query("nrep", nrep);
+        }
+
+        RealBox real_box;
+        for (int n = 0; n < AMREX_SPACEDIM; n++) {
+            real_box.setLo(n, 0.0);
+            real_box.setHi(n, 1.0);
+        }
+        const Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+                         IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+        int is_per[AMREX_SPACEDIM];
+        for (int i = 0; i < AMREX_SPACEDIM; i++) is_per[i] = 0;
+        Geometry geom(domain, &real_box, CoordSys::cartesian, is_per);
+
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dmap(ba);
+
+        MyParticleContainer pc(geom, dmap, ba);
+        MyParticleContainer::ParticleInitData pdata = {{1.0},{},{2.0,3.0},{7}};
+        pc.InitRandom(long(nppc)*domain.numPts(), 451, pdata, false);
+
+        for (MyParIter pti(pc, 0); pti.isValid(); ++pti) {
+            auto& aos = pti.GetArrayOfStructs();
+            auto& rdata = pti.GetStructOfArrays().GetRealData(0);
+            for (int i = 0; i < aos.numParticles(); ++i) {
+                aos[i].m_rdata.arr[AMREX_SPACEDIM] = aos[i].m_rdata.pos[1];
+                rdata[i] = aos[i].m_rdata.pos[2];
+            }
+        }
+
+        amrex::Print() << "Particles: " << pc.TotalNumberOfParticles() << "\n";
+
+        //
+        // The AoS mode.
+        //
+        const Real t0 = loop_time(pc, nrep);
+        const long b0 = bytes(pc);
+
+        long ninvalid = invalidate(pc, keep_x);
+        Vector<Real> ref = checksums(pc);
+
+        Real t = ParallelDescriptor::second();
+        long nremoved = pc.RemoveInvalidParticles();
+        t = ParallelDescriptor::second() - t;
+        ParallelDescriptor::ReduceLongSum(nremoved);
+        ParallelDescriptor::ReduceRealMax(t);
+
+        check(pc, ref, nremoved, ninvalid);
+
+        const Real t1 = loop_time(pc, nrep);
+        const long b1 = bytes(pc);
+
+        amrex::Print() << "AoS mode: removed " << nremoved << " particles in " << t << " s\n"
+                       << "  memory " << b0 << " -> " << b1 << " bytes\n"
+                       << "  loop time " << t0 << " -> " << t1 << " s\n";
+
+        //
+        // The SoA mode.
+        //
+        pc.ConvertToSoA(0);
+        ninvalid = invalidate(pc, keep_x/2);
+        pc.ConvertToAoS(0);
+        ref = checksums(pc);
+        pc.ConvertToSoA(0);
+
+        nremoved = pc.RemoveInvalidParticles();
+        ParallelDescriptor::ReduceLongSum(nremoved);
+
+        pc.ConvertToAoS(0);
+        check(pc, ref, nremoved, ninvalid);
+
+        amrex::Print() << "SoA mode: removed " << nremoved << " particles\n";
+
+        //
+        // Redistribute keeps the same particles.
+        //
+        pc.Redistribute();
+        check(pc, ref, 0, 0);
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,210 @@
+// Test of the load balancing with a cost model for a mesh with particles.
+//
+// The particles are clustered in a corner of the domain and every step
+// does some synthetic work on each cell and on each particle.  The boxes
+// are distributed with the cost of the cells only, the weights of a cell
+// and of a particle are measured with DistributionMapping::FitCostWeights,
+// and the boxes are distributed again with the combined cost, with the
+// knapsack and the space filling curve algorithms.  The ratio of the
+// largest to the average time per process is printed for every mapping.
+
+#include <algorithm>
+#include <ctime>
+#include <iostream>
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_Particles.H>
+
+using namespace amrex;
+
+namespace {
+
+using MyParticleContainer = ParticleContainer<1, 0>;
+using MyParIter           = ParIter<1, 0>;
+
+int cell_work = 4;
+int particle_work = 100;
+int nsteps = 3;
+
+// The CPU time this process spends on the synthetic work of nsteps steps.
+// This is the CPU time, not the wall clock time, so that the measurement
+// is not disturbed if there are more processes than cores.
+Real work (MultiFab& mf, MyParticleContainer& pc)
+{
+    const std::clock_t start = std::clock();
+
+    for (int step = 0; step < nsteps; ++step)
+    {
+        for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            Real* dp = mf[mfi].dataPtr();
+            const long n = mf[mfi].box().numPts();
+            for (long i = 0; i < n; ++i) {
+                for (int k = 0; k < cell_work; ++k) {
+                    dp[i] = dp[i]*0.999 + 1.0;
+                }
+            }
+        }
+
+        for (MyParIter pti(pc, 0); pti.isValid(); ++pti) {
+            for (auto& p : pti.GetArrayOfStructs()) {
+                Real& x = p.m_rdata.arr[AMREX_SPACEDIM];
+                for (int k = 0; k < particle_work; ++k) {
+                    x = x*0.999 + 1.e-3;
+                }
+            }
+        }
+    }
+
+    return static_cast<Real>(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+// Runs the synthetic work on the mapping dm.  Returns the time of this
+// process and its number of cells and particles.
+Real run (const std::string& name, const BoxArray& ba, const DistributionMapping& dm,
+          MyParticleContainer& pc, long& ncells, long& nparticles)
+{
+    pc.SetParticleDistributionMap(0, dm);
+    pc.Redistribute();
+
+    MultiFab mf(ba, dm, 1, 0);
+    mf.setVal(0.0);
+
+    ncells = 0;
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        ncells += mfi.validbox().numPts();
+    }
+    nparticles = pc.NumberOfParticlesAtLevel(0, true, true);
+
+    const Real t = work(mf, pc);
+
+    Real tmax = t, tsum = t;
+    ParallelDescriptor::ReduceRealMax(tmax);
+    ParallelDescriptor::ReduceRealSum(tsum);
+    const Real tavg = tsum / ParallelDescriptor::NProcs();
+
+    amrex::Print() << "  " << name << ": max time " << tmax << ", average time " << tavg
+                   << ", imbalance " << tmax/tavg << "\n";
+
+    return t;
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 16;
+        long nparticles = 400000;
+        Real cluster_size = 0.5;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nparticles", nparticles);
+            pp.query("cluster_size", cluster_size);
+            pp.query("cell_work", cell_work);
+            pp.query("particle_work", particle_work);
+            pp.query("nsteps", nsteps);
+        }
+
+        RealBox real_box;
+        for (int n = 0; n < AMREX_SPACEDIM; n++) {
+            real_box.setLo(n, 0.0);
+            real_box.setHi(n, 1.0);
+        }
+        const Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+                         IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+        int is_per[AMREX_SPACEDIM];
+        for (int i = 0; i < AMREX_SPACEDIM; i++) is_per[i] = 1;
+        Geometry geom(domain, &real_box, CoordSys::cartesian, is_per);
+
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dmap(ba);
+
+        RealBox cluster;
+        for (int n = 0; n < AMREX_SPACEDIM; n++) {
+            cluster.setLo(n, 0.0);
+            cluster.setHi(n, cluster_size);
+        }
+
+        MyParticleContainer pc(geom, dmap, ba);
+        MyParticleContainer::ParticleInitData pdata = {{1.0},{},{},{}};
+        pc.InitRandom(nparticles, 451, pdata, false, cluster);
+
+        //
+        // The particle counts per box, on the grids of the particles and on
+        // finer boxes.
+        //
+        const Vector<long>& npgrid = pc.NumberOfParticlesInGrid(0);
+        const Vector<long>& npbox  = pc.NumberOfParticlesInBoxes(0, ba);
+        if (npgrid != npbox) {
+            amrex::Abort("NumberOfParticlesInBoxes differs from NumberOfParticlesInGrid");
+        }
+
+        BoxArray fine_ba(ba);
+        fine_ba.maxSize(max_grid_size/2);
+        const Vector<long>& npfine = pc.NumberOfParticlesInBoxes(0, fine_ba);
+        long total = 0;
+        for (long n : npfine) total += n;
+        if (total != pc.TotalNumberOfParticles()) {
+            amrex::Abort("NumberOfParticlesInBoxes misses particles");
+        }
+        pc.ConvertToSoA(0);
+        if (pc.NumberOfParticlesInBoxes(0, fine_ba) != npfine) {
+            amrex::Abort("NumberOfParticlesInBoxes differs in the SoA mode");
+        }
+        pc.ConvertToAoS(0);
+
+        //
+        // Without particles, the particle costs are all zero and the boxes
+        // get the same weight.
+        //
+        {
+            const Vector<Real> zero_cost(ba.size(), 0.0);
+            const DistributionMapping& zdm = DistributionMapping::makeKnapSack(zero_cost);
+            Vector<int> nboxes(ParallelDescriptor::NProcs(), 0);
+            for (int i = 0; i < ba.size(); ++i) ++nboxes[zdm[i]];
+            const auto mm = std::minmax_element(nboxes.begin(), nboxes.end());
+            if (*mm.second - *mm.first > 1) {
+                amrex::Abort("makeKnapSack does not balance zero costs");
+            }
+        }
+
+        amrex::Print() << "Boxes: " << ba.size() << ", processes: " << ParallelDescriptor::NProcs()
+                       << ", particles: " << pc.TotalNumberOfParticles() << "\n";
+
+        long ncells, npart;
+
+        const Vector<Real>& cell_cost = DistributionMapping::makeCombinedCost(ba, Vector<long>(), 1.0, 0.0);
+        const Real t = run("cells only", ba, DistributionMapping::makeKnapSack(cell_cost),
+                           pc, ncells, npart);
+
+        Real cell_weight = 1.0, particle_weight = 0.0;
+        if (DistributionMapping::FitCostWeights(ncells, npart, t, cell_weight, particle_weight)) {
+            amrex::Print() << "  measured weights: cell " << cell_weight
+                           << ", particle " << particle_weight << "\n";
+        } else {
+            //
+            // With one process, or with the same ratio of particles to cells
+            // on all processes, the weights cannot be measured.
+            //
+            cell_weight = 1.0;
+            particle_weight = Real(particle_work) / Real(cell_work);
+            amrex::Print() << "  weights cannot be measured, using cell " << cell_weight
+                           << ", particle " << particle_weight << "\n";
+        }
+
+        const Vector<Real>& cost = DistributionMapping::makeCombinedCost(ba, npbox, cell_weight,
+                                                                         particle_weight);
+        run("knapsack, cells and particles", ba, DistributionMapping::makeKnapSack(cost),
+            pc, ncells, npart);
+        run("sfc, cells and particles", ba, DistributionMapping::makeSFC(cost, ba),
+            pc, ncells, npart);
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,336 @@
+// Benchmark of the batched C++ particle kernels (see AMReX_ParticleKernels.H)
+// against the Fortran kernel and the per particle C++ interpolation.
+//
+// moveKick is timed with the Fortran kernel amrex_move_kick_soa on tiles
+// in the SoA mode, with the C++ kernel on tiles in the SoA and the AoS
+// modes, and with the interpolation by Particle::GetGravity particle by
+// particle that moveKick used for the AoS mode.  The acceleration is a
+// linear function, which the CIC interpolation reproduces exactly, so the
+// results are also checked against the exact values.  Then
+// InterpolateSingleLevel is timed for the three shapes, and
+// TracerParticleContainer::AdvectWithUmac is checked against the exact
+// midpoint rule for a linear velocity.
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_Particles.H>
+#include <AMReX_TracerParticles.H>
+
+using namespace amrex;
+
+namespace {
+
+// mass, velocity and acceleration
+constexpr int NSR = 1 + 2*AMREX_SPACEDIM;
+using MyParticleContainer = ParticleContainer<NSR, 0, 1, 0>;
+using MyParIter           = ParIter<NSR, 0, 1, 0>;
+
+// The acceleration and the velocity of the tests, linear in x.
+Real field (int d, const Real* x)
+{
+    return (d+1) + 0.5*x[0] - 0.25*x[1] + 0.125*x[2];
+}
+
+// Fills all the points of mf, ghost points included, with field().
+void fill (MultiFab& mf, const Geometry& geom)
+{
+    const Real* plo = geom.ProbLo();
+    const Real* dx  = geom.CellSize();
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        FArrayBox& fab = mf[mfi];
+        const Box& bx = fab.box();
+        for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv)) {
+            Real x[3] = {0.0, 0.0, 0.0};
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                x[d] = plo[d] + dx[d]*(iv[d] + (bx.type(d) == IndexType::CELL ? 0.5 : 0.0));
+            }
+            for (int n = 0; n < mf.nComp(); ++n) {
+                fab(iv,n) = field(n, x);
+            }
+        }
+    }
+}
+
+// The largest error of the accelerations stored by moveKick, and the sum of
+// the velocities.
+std::pair<Real,Real> check_kick (MyParticleContainer& pc)
+{
+    Real err = 0.0, vsum = 0.0;
+    for (auto& kv : pc.GetParticles(0)) {
+        auto& tile = kv.second;
+        if (tile.isSoA()) {
+            const auto& sp = tile.GetSoAParticles();
+            for (int i = 0; i < sp.numParticles(); ++i) {
+                Real x[3] = {0.0, 0.0, 0.0};
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) x[d] = sp.pos(d)[i];
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    err = std::max(err, std::abs(sp.rdata(1+AMREX_SPACEDIM+d)[i] - field(d,x)));
+                    vsum += sp.rdata(1+d)[i];
+                }
+            }
+        } else {
+            for (const auto& p : tile.GetArrayOfStructs()) {
+                Real x[3] = {0.0, 0.0, 0.0};
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) x[d] = p.m_rdata.pos[d];
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    err = std::max(err, std::abs(p.m_rdata.arr[2*AMREX_SPACEDIM+1+d] - field(d,x)));
+                    vsum += p.m_rdata.arr[AMREX_SPACEDIM+1+d];
+                }
+            }
+        }
+    }
+    ParallelDescriptor::ReduceRealMax(err);
+    ParallelDescriptor::ReduceRealSum(vsum);
+    return std::make_pair(err, vsum);
+}
+
+// Zeroes the velocities and the accelerations.
+void set_velocity (MyParticleContainer& pc)
+{
+    for (auto& kv : pc.GetParticles(0)) {
+        auto& tile = kv.second;
+        if (tile.isSoA()) {
+            auto& sp = tile.GetSoAParticles();
+            for (int d = 0; d < 2*AMREX_SPACEDIM; ++d) {
+                std::fill(sp.rdata(1+d), sp.rdata(1+d) + sp.numParticles(), 0.0);
+            }
+        } else {
+            for (auto& p : tile.GetArrayOfStructs()) {
+                for (int d = 0; d < 2*AMREX_SPACEDIM; ++d) p.m_rdata.arr[AMREX_SPACEDIM+1+d] = 0.0;
+            }
+        }
+    }
+}
+
+void report (const std::string& name, Real t, long np, int nrep)
+{
+    ParallelDescriptor::ReduceRealMax(t);
+    amrex::Print() << "  " << name << ": " << t << " s, "
+                   << Real(np)*nrep/t/1.e6 << " Mparticles/s\n";
+}
+
+void check (const std::string& name, Real err, Real tol)
+{
+    if (err > tol) {
+        amrex::Print() << name << ": error " << err << "\n";
+        amrex::Abort("wrong particle kernel result");
+    }
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 32;
+        int nppc = 4;
+        int nrep = 5;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nppc", nppc);
+            pp.query("nrep", nrep);
+        }
+
+        RealBox real_box;
+        for (int n = 0; n < AMREX_SPACEDIM; n++) {
+            real_box.setLo(n, 0.0);
+            real_box.setHi(n, 1.0);
+        }
+        const Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+                         IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+        int is_per[AMREX_SPACEDIM];
+        for (int i = 0; i < AMREX_SPACEDIM; i++) is_per[i] = 1;
+        Geometry geom(domain, &real_box, CoordSys::cartesian, is_per);
+
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dmap(ba);
+
+        MyParticleContainer pc(geom, dmap, ba);
+        MyParticleContainer::ParticleInitData pdata = {{1.0},{},{},{}};
+        pc.InitRandom(long(nppc)*domain.numPts(), 451, pdata, false);
+        const long np = pc.TotalNumberOfParticles();
+
+        MultiFab acc(ba, dmap, AMREX_SPACEDIM, 1);
+        fill(acc, geom);
+
+        const Real dt = 0.1;
+        const Real tol = 1.e-12;
+
+        amrex::Print() << "Particles: " << np << "\n";
+        amrex::Print() << "moveKick, CIC, " << AMREX_SPACEDIM << " components:\n";
+
+        //
+        // The Fortran kernel.
+        //
+        set_velocity(pc);
+        pc.ConvertToSoA(0);
+        {
+            const Real* plo = geom.ProbLo();
+            const Real* dx  = geom.CellSize();
+            Real t = ParallelDescriptor::second();
+            for (int r = 0; r < nrep; ++r) {
+                for (auto& kv : pc.GetParticles(0)) {
+                    auto& soa = kv.second.GetSoAParticles();
+                    const auto& shape = soa.dataShape();
+                    const FArrayBox& gfab = acc[kv.first.first];
+                    amrex_move_kick_soa(soa.data(), shape.first, shape.second, soa.id(),
+                                        gfab.dataPtr(), gfab.loVect(), gfab.hiVect(), gfab.nComp(),
+                                        plo, dx, 0.5*dt, 1.0, 1.0, 1+AMREX_SPACEDIM);
+                }
+            }
+            t = ParallelDescriptor::second() - t;
+            report("Fortran, SoA       ", t, np, nrep);
+        }
+        const auto& fortran = check_kick(pc);
+        check("Fortran, SoA", fortran.first, tol);
+
+        //
+        // The C++ kernel.
+        //
+        set_velocity(pc);
+        {
+            Real t = ParallelDescriptor::second();
+            for (int r = 0; r < nrep; ++r) {
+                pc.moveKick(acc, 0, dt, 1.0, 1.0, 1+AMREX_SPACEDIM);
+            }
+            t = ParallelDescriptor::second() - t;
+            report("C++ kernel, SoA    ", t, np, nrep);
+        }
+        const auto& cpp_soa = check_kick(pc);
+        check("C++ kernel, SoA", cpp_soa.first, tol);
+        check("C++ kernel, SoA velocity", std::abs(cpp_soa.second-fortran.second), tol*std::abs(fortran.second));
+
+        pc.ConvertToAoS(0);
+        set_velocity(pc);
+        {
+            Real t = ParallelDescriptor::second();
+            for (int r = 0; r < nrep; ++r) {
+                pc.moveKick(acc, 0, dt, 1.0, 1.0, 1+AMREX_SPACEDIM);
+            }
+            t = ParallelDescriptor::second() - t;
+            report("C++ kernel, AoS    ", t, np, nrep);
+        }
+        const auto& cpp_aos = check_kick(pc);
+        check("C++ kernel, AoS", cpp_aos.first, tol);
+        check("C++ kernel, AoS velocity", std::abs(cpp_aos.second-fortran.second), tol*std::abs(fortran.second));
+
+        //
+        // Particle by particle.
+        //
+        set_velocity(pc);
+        {
+            Real t = ParallelDescriptor::second();
+            for (int r = 0; r < nrep; ++r) {
+                for (MyParIter pti(pc, 0); pti.isValid(); ++pti) {
+                    const FArrayBox& gfab = acc[pti];
+                    for (auto& p : pti.GetArrayOfStructs()) {
+                        Real grav[AMREX_SPACEDIM];
+                        MyParticleContainer::ParticleType::GetGravity(gfab, geom, p, grav);
+                        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                            p.m_rdata.arr[AMREX_SPACEDIM+1+d] += 0.5*dt*grav[d];
+                            p.m_rdata.arr[2*AMREX_SPACEDIM+1+d] = grav[d];
+                        }
+                    }
+                }
+            }
+            t = ParallelDescriptor::second() - t;
+            report("GetGravity, AoS    ", t, np, nrep);
+        }
+        check("GetGravity, AoS", check_kick(pc).first, tol);
+
+        //
+        // InterpolateSingleLevel into the struct data and the array data.
+        //
+        amrex::Print() << "InterpolateSingleLevel:\n";
+        {
+            Real t = ParallelDescriptor::second();
+            for (int r = 0; r < nrep; ++r) pc.InterpolateSingleLevel<0,AMREX_SPACEDIM>(acc, 0, 0, 1+AMREX_SPACEDIM);
+            report("NGP, 3 components  ", ParallelDescriptor::second() - t, np, nrep);
+
+            t = ParallelDescriptor::second();
+            for (int r = 0; r < nrep; ++r) pc.InterpolateSingleLevel<2,AMREX_SPACEDIM>(acc, 0, 0, 1+AMREX_SPACEDIM);
+            report("TSC, 3 components  ", ParallelDescriptor::second() - t, np, nrep);
+            check("TSC", check_kick(pc).first, tol);
+
+            t = ParallelDescriptor::second();
+            for (int r = 0; r < nrep; ++r) pc.InterpolateSingleLevel<1,AMREX_SPACEDIM>(acc, 0, 0, 1+AMREX_SPACEDIM);
+            report("CIC, 3 components  ", ParallelDescriptor::second() - t, np, nrep);
+            check("CIC", check_kick(pc).first, tol);
+
+            t = ParallelDescriptor::second();
+            for (int r = 0; r < nrep; ++r) pc.InterpolateSingleLevel<1,1>(acc, 0, 0, 0, true);
+            report("CIC, 1 component   ", ParallelDescriptor::second() - t, np, nrep);
+
+            Real err = 0.0;
+            for (MyParIter pti(pc, 0); pti.isValid(); ++pti) {
+                const auto& aos = pti.GetArrayOfStructs();
+                const auto& a = pti.GetStructOfArrays().GetRealData(0);
+                for (int i = 0; i < aos.numParticles(); ++i) {
+                    Real x[3] = {0.0, 0.0, 0.0};
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) x[d] = aos[i].m_rdata.pos[d];
+                    err = std::max(err, std::abs(a[i] - field(0,x)));
+                }
+            }
+            ParallelDescriptor::ReduceRealMax(err);
+            check("CIC, array data", err, tol);
+        }
+
+        //
+        // AdvectWithUmac.  For u = field(0,x), the midpoint rule moves a
+        // particle by dt*u(x + dt/2*u(x)).  The particles move by less than
+        // a cell, so the velocities are interpolated within the ghost cells.
+        //
+        {
+            const Real dt = 0.25*geom.CellSize(0);
+
+            TracerParticleContainer tpc(geom, dmap, ba);
+            TracerParticleContainer::ParticleInitData tdata = {{AMREX_D_DECL(0.0,0.0,0.0)},{},{},{}};
+            tpc.InitRandom(long(nppc)*domain.numPts(), 451, tdata, false);
+
+            MultiFab umac[AMREX_SPACEDIM];
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                umac[d].define(amrex::convert(ba, IntVect::TheDimensionVector(d)), dmap, 1, 1);
+                fill(umac[d], geom);
+            }
+
+            Vector<Real> expected;
+            for (TracerParIter pti(tpc, 0); pti.isValid(); ++pti) {
+                for (const auto& p : pti.GetArrayOfStructs()) {
+                    Real x[3] = {0.0, 0.0, 0.0}, xh[3] = {0.0, 0.0, 0.0};
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) x[d] = p.m_rdata.pos[d];
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) xh[d] = x[d] + 0.5*dt*field(0,x);
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) expected.push_back(x[d] + dt*field(0,xh));
+                }
+            }
+
+            Real t = ParallelDescriptor::second();
+            tpc.AdvectWithUmac(umac, 0, dt);
+            t = ParallelDescriptor::second() - t;
+            amrex::Print() << "AdvectWithUmac:\n";
+            report("CIC, 1 component   ", t, np, 1);
+
+            Real err = 0.0;
+            int n = 0;
+            for (TracerParIter pti(tpc, 0); pti.isValid(); ++pti) {
+                for (const auto& p : pti.GetArrayOfStructs()) {
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                        err = std::max(err, std::abs(p.m_rdata.pos[d] - expected[n++]));
+                    }
+                }
+            }
+            ParallelDescriptor::ReduceRealMax(err);
+            check("AdvectWithUmac", err, tol);
+        }
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,136 @@
+
+// Benchmark of the per-tile particle storage with many small tiles.
+//
+// The first part times ParIter sweeps and Redistribute of a
+// ParticleContainer.  The second part times the lookups and the
+// iteration that they do, with std::map<std::pair<int,int>,ParticleTile>
+// (the former ParticleLevel) and with ParticleTileStorage.
+
+#include <iostream>
+#include <map>
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Particles.H>
+
+using namespace amrex;
+
+namespace {
+
+using MyParticleContainer = ParticleContainer<1+AMREX_SPACEDIM>;
+using MyParIter           = ParIter<1+AMREX_SPACEDIM>;
+using TileType            = MyParticleContainer::ParticleTileType;
+
+template <class Level>
+void time_level (const std::string& name, const Vector<std::pair<int,int> >& keys, int nsteps)
+{
+    Level level;
+    for (const auto& key : keys) {
+        level[key].push_back(MyParticleContainer::ParticleType());
+    }
+
+    long n = 0;
+    const Real t0 = amrex::second();
+    for (int step = 0; step < nsteps; ++step) {
+        for (const auto& key : keys) {
+            auto f = level.find(key);
+            if (f != level.end()) n += f->second.numParticles();
+        }
+    }
+    const Real t1 = amrex::second();
+    for (int step = 0; step < nsteps; ++step) {
+        for (const auto& kv : level) {
+            n += kv.second.numParticles();
+        }
+    }
+    const Real t2 = amrex::second();
+
+    amrex::Print() << "  " << name << ": find " << (t1-t0)/nsteps
+                   << " s, iterate " << (t2-t1)/nsteps << " s per sweep ("
+                   << n << ")\n";
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 32;
+        int nppc = 2;
+        int nsteps = 10;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nppc", nppc);
+            pp.query("nsteps", nsteps);
+        }
+
+        RealBox real_box;
+        for (int n = 0; n < AMREX_SPACEDIM; n++) {
+            real_box.setLo(n, 0.0);
+            real_box.setHi(n, 1.0);
+        }
+        const Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+                         IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+        int is_per[AMREX_SPACEDIM];
+        for (int i = 0; i < AMREX_SPACEDIM; i++) is_per[i] = 1;
+        Geometry geom(domain, &real_box, CoordSys::cartesian, is_per);
+
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dmap(ba);
+
+        MyParticleContainer myPC(geom, dmap, ba);
+        MyParticleContainer::ParticleInitData pdata = {1.0, 0.0, 0.0, 0.0};
+        myPC.InitRandom(long(nppc)*domain.numPts(), 451, pdata, false);
+
+        amrex::Print() << "Number of particles : " << myPC.TotalNumberOfParticles() << "\n"
+                       << "Number of grids     : " << ba.size() << "\n"
+                       << "Number of tiles     : " << myPC.numLocalTilesAtLevel(0) << "\n";
+
+        const Real* dx = geom.CellSize();
+
+        Real t_pariter = 0.0, t_redistribute = 0.0;
+        for (int step = 0; step < nsteps; ++step)
+        {
+            const Real t0 = amrex::second();
+            long n = 0;
+#ifdef _OPENMP
+#pragma omp parallel reduction(+:n)
+#endif
+            for (MyParIter pti(myPC, 0); pti.isValid(); ++pti) {
+                n += pti.numParticles();
+            }
+            t_pariter += amrex::second() - t0;
+
+            // Move the particles by half a cell so that some change tiles.
+            for (MyParIter pti(myPC, 0); pti.isValid(); ++pti) {
+                auto& aos = pti.GetArrayOfStructs();
+                for (int i = 0; i < aos.numParticles(); ++i) {
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                        aos[i].pos(d) += ((step+i+d)%2 ? 0.5 : -0.5)*dx[d];
+                    }
+                }
+            }
+
+            const Real t1 = amrex::second();
+            myPC.Redistribute();
+            t_redistribute += amrex::second() - t1;
+        }
+
+        amrex::Print() << "ParIter sweep  : " << t_pariter/nsteps << " s\n"
+                       << "Redistribute   : " << t_redistribute/nsteps << " s\n";
+
+        Vector<std::pair<int,int> > keys;
+        for (MFIter mfi = myPC.MakeMFIter(0); mfi.isValid(); ++mfi) {
+            keys.push_back(std::make_pair(mfi.index(), mfi.LocalTileIndex()));
+        }
+        amrex::Print() << "Tile lookups with " << keys.size() << " tiles:\n";
+        time_level<std::map<std::pair<int,int>,TileType> >("std::map           ", keys, 100*nsteps);
+        time_level<ParticleTileStorage<TileType> >        ("ParticleTileStorage", keys, 100*nsteps);
+    }
+    amrex::Finalize();
+}
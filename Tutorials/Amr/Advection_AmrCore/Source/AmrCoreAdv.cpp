@@ -553,6 +553,14 @@ AmrCoreAdv::timeStep (int lev, Real time, int iteration)
         amrex::Print() << "Advanced " << CountCells(lev) << " cells" << std::endl;
     }
 
+    if (do_reflux && lev > 0 && iteration == nsubsteps[lev])
+    {
+        // the flux register between lev-1 and lev is complete after the last
+        // substep of lev, so start its communication while the finer levels
+        // advance; Reflux_finish is called in timeStep(lev-1)
+        flux_reg[lev]->Reflux_nowait(phi_new[lev-1], 1.0, 0, 0, phi_new[lev-1].nComp(), geom[lev-1]);
+    }
+
     if (lev < finest_level)
     {
         // recursive call for next-finer level
@@ -564,7 +572,7 @@ AmrCoreAdv::timeStep (int lev, Real time, int iteration)
 	if (do_reflux)
 	{
             // update lev based on coarse-fine flux mismatch
-	    flux_reg[lev+1]->Reflux(phi_new[lev], 1.0, 0, 0, phi_new[lev].nComp(), geom[lev]);
+	    flux_reg[lev+1]->Reflux_finish();
 	}
 
 	AverageDownTo(lev); // average lev+1 down to lev
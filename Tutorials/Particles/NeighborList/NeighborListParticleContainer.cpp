@@ -90,7 +90,7 @@ void NeighborListParticleContainer::computeForcesNL() {
 
     const int lev = 0;
 
-    buildNeighborList(lev);
+    if (!use_verlet) buildNeighborList(lev);
 
 #ifdef _OPENMP
 #pragma omp parallel
@@ -108,6 +108,11 @@ void NeighborListParticleContainer::computeForcesNL() {
     }
 }
 
+void NeighborListParticleContainer::setVerletSkin(const Real skin) {
+    setVerletList(cutoff, skin);
+    use_verlet = true;
+}
+
 void NeighborListParticleContainer::moveParticles(const Real dt) {
 
     BL_PROFILE("NeighborListParticleContainer::moveParticles");
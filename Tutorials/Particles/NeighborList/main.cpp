@@ -22,6 +22,9 @@ int main(int argc, char* argv[])
     pp.get("dt", dt);
     pp.get("do_nl", do_nl);
 
+    Real verlet_skin = 0.0;
+    pp.query("verlet_skin", verlet_skin);
+
     RealBox real_box;
     for (int n = 0; n < BL_SPACEDIM; n++) {
         real_box.setLo(n, 0.0);
@@ -49,9 +52,24 @@ int main(int argc, char* argv[])
 
     const int lev = 0;
 
+    if (verlet_skin > 0.0) {
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(do_nl, "verlet_skin requires do_nl = 1");
+        myPC.setVerletSkin(verlet_skin);
+    }
+
+    int num_rebuilds = 0;
     for (int i = 0; i < max_step; i++) {
         if (write_particles) myPC.writeParticles(i);
         
+        if (verlet_skin > 0.0) {
+            // the neighbors and lists are kept between steps, and the
+            // particles are only redistributed when the lists are rebuilt
+            if (myPC.fillNeighborsVerlet(lev)) ++num_rebuilds;
+            myPC.computeForcesNL();
+            myPC.moveParticles(dt);
+            continue;
+        }
+
         myPC.fillNeighbors(lev);
 
         if (do_nl) { myPC.computeForcesNL(); } 
@@ -64,6 +82,13 @@ int main(int argc, char* argv[])
         myPC.Redistribute();
     }
 
+    if (verlet_skin > 0.0) {
+        amrex::Print() << "Neighbor lists rebuilt " << num_rebuilds
+                       << " times in " << max_step << " steps\n";
+        myPC.clearNeighbors(lev);
+        myPC.Redistribute();
+    }
+
     if (write_particles) myPC.writeParticles(max_step);
     
     amrex::Finalize();